@@ -0,0 +1,60 @@
+#include "assignmentIndex.hpp"
+
+/**
+ * Builds the index from a solution: one cut per pair of consecutive clusters,
+ * at the middle of the gap between the last point of the first and the first
+ * point of the second, and the coordinates of each cluster's medoid. Without
+ * a center per interval, points are assigned by the cuts alone
+ *
+ * @param sortedPoints Flat coordinates sorted by first coordinate (N x dimension)
+ * @param dimension Dimension of the points
+ * @param intervals Clusters in sorted order, [first, last] inclusive
+ * @param centers Index of the medoid (or median) of each interval
+ */
+void AssignmentIndex::build(const std::vector<double>& sortedPoints, size_t dimension,
+                            const std::vector<std::pair<unsigned int, unsigned int>>& intervals,
+                            const std::vector<size_t>& centers) {
+    dim = dimension;
+    numClusters = intervals.size();
+
+    paddedSize = 1;
+    while (paddedSize < numClusters) paddedSize *= 2;
+
+    // Les seuils de complément (+infini) ne sont jamais <= x : position() reste dans [0, K-1]
+    cuts.assign(paddedSize, std::numeric_limits<double>::infinity());
+    for (size_t c = 0; c + 1 < numClusters; c++) {
+        double last = sortedPoints[intervals[c].second * dim];
+        double next = sortedPoints[intervals[c + 1].first * dim];
+        cuts[c] = 0.5 * (last + next);
+    }
+
+    hasMedoids = centers.size() >= numClusters;
+    medoids.assign(numClusters * dim, 0.0);
+    medoidIndices.assign(centers.begin(), centers.end());
+    for (size_t c = 0; c < numClusters && c < centers.size(); c++) {
+        for (size_t d = 0; d < dim; d++) {
+            medoids[c * dim + d] = sortedPoints[centers[c] * dim + d];
+        }
+    }
+}
+
+/**
+ * Assigns a batch of points: branch-free search of the slice, then the
+ * pruned nearest-medoid scan around it, split statically across threads
+ *
+ * @param queryPoints Coordinates of point i at queryPoints[i * stride]
+ * @param count Number of points
+ * @param stride Distance in doubles between two consecutive points (>= D)
+ * @param labels Output: labels in 1..K
+ */
+void AssignmentIndex::assignBatch(const double* queryPoints, size_t count, size_t stride, size_t* labels) const {
+    if (numClusters == 0) return;
+
+    bool useParallel = (count > 16384);
+
+#pragma omp parallel for if(useParallel) schedule(static)
+    for (size_t i = 0; i < count; i++) {
+        const double* point = queryPoints + i * stride;
+        labels[i] = 1 + nearestMedoid(point, position(point[0]));
+    }
+}
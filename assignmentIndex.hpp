@@ -0,0 +1,104 @@
+#pragma once
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <limits>
+
+/**
+ * Index d'affectation de nouveaux points aux clusters d'une solution par intervalles.
+ * Les clusters sont des intervalles consécutifs selon la première coordonnée : la
+ * tranche [seuil précédent, seuil suivant[ qui contient la première coordonnée du
+ * point, le seuil entre deux clusters étant le milieu de l'écart qui les sépare, est
+ * trouvée par recherche dichotomique sans branchement en O(log K) sur un tableau de
+ * seuils complété à une puissance de 2. Le point est ensuite affecté au cluster de
+ * médoïde le plus proche, cherché à partir de cette tranche vers ses voisines tant que
+ * l'écart sur la première coordonnée reste sous la meilleure distance : un point hors
+ * du front peut être plus proche d'un médoïde voisin que de celui de sa tranche.
+ */
+class AssignmentIndex {
+public:
+    AssignmentIndex() : dim(0), numClusters(0), paddedSize(1), hasMedoids(false) {}
+
+    // intervals : clusters [début, fin] dans l'ordre trié, centers : indice du médoïde de chacun
+    void build(const std::vector<double>& sortedPoints, size_t dimension,
+               const std::vector<std::pair<unsigned int, unsigned int>>& intervals,
+               const std::vector<size_t>& centers);
+
+    bool isBuilt() const { return numClusters > 0; }
+    size_t getNbClusters() const { return numClusters; }
+    size_t getDimension() const { return dim; }
+
+    // Étiquette (1..K, comme Solver::getSolution) du point de coordonnées point[0..D-1]
+    inline size_t assign(const double* point) const {
+        return 1 + nearestMedoid(point, position(point[0]));
+    }
+
+    // Étiquette de la tranche seule, sans comparaison aux médoïdes : non décroissante selon la première coordonnée
+    inline size_t assignToSlice(const double* point) const {
+        return 1 + position(point[0]);
+    }
+
+    // Affecte count points (stride doubles entre deux points consécutifs) en parallèle
+    void assignBatch(const double* queryPoints, size_t count, size_t stride, size_t* labels) const;
+
+    const double* medoid(size_t label) const { return &medoids[(label - 1) * dim]; }
+    size_t medoidIndex(size_t label) const { return medoidIndices[label - 1]; }
+    const std::vector<double>& getCuts() const { return cuts; }
+
+private:
+    size_t dim;
+    size_t numClusters;
+    size_t paddedSize;          // Puissance de 2 >= K
+    std::vector<double> cuts;   // K-1 seuils croissants puis +infini
+    std::vector<double> medoids;
+    std::vector<size_t> medoidIndices;
+    bool hasMedoids;            // Un médoïde par cluster : sinon, affectation à la tranche seule
+
+    // Nombre de seuils <= x, en log2(paddedSize) étapes sans branchement
+    inline size_t position(double x) const {
+        const double* c = cuts.data();
+        size_t pos = 0;
+        for (size_t step = paddedSize / 2; step > 0; step /= 2) {
+            pos += (c[pos + step - 1] <= x) ? step : 0;
+        }
+        return pos;
+    }
+
+    inline double squaredDistanceToMedoid(const double* point, size_t cluster) const {
+        const double* m = &medoids[cluster * dim];
+        double result = 0.0;
+        for (size_t d = 0; d < dim; d++) {
+            double diff = point[d] - m[d];
+            result += diff * diff;
+        }
+        return result;
+    }
+
+    // Cluster de médoïde le plus proche, cherché de part et d'autre de slot. Les médoïdes sont triés selon la première
+    // coordonnée et ceux des clusters avant (après) la tranche sont à gauche (à droite) du point : l'écart sur cette
+    // coordonnée croît en s'éloignant, et la recherche s'arrête dès qu'il dépasse la meilleure distance
+    inline size_t nearestMedoid(const double* point, size_t slot) const {
+        if (!hasMedoids) return slot;
+        size_t best = slot;
+        double bestDistance = squaredDistanceToMedoid(point, slot);
+        for (size_t c = slot; c-- > 0;) {
+            double gap = point[0] - medoids[c * dim];
+            if (gap * gap >= bestDistance) break;
+            double distance = squaredDistanceToMedoid(point, c);
+            if (distance < bestDistance) {
+                best = c;
+                bestDistance = distance;
+            }
+        }
+        for (size_t c = slot + 1; c < numClusters; c++) {
+            double gap = medoids[c * dim] - point[0];
+            if (gap * gap >= bestDistance) break;
+            double distance = squaredDistanceToMedoid(point, c);
+            if (distance < bestDistance) {
+                best = c;
+                bestDistance = distance;
+            }
+        }
+        return best;
+    }
+};
@@ -0,0 +1,176 @@
+#include "checkpoint.hpp"
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+
+const char MAGIC[8] = {'C', 'L', 'U', 'S', 'T', 'D', 'P', '1'};
+
+bool writeAll(int fd, const void* data, size_t bytes, off_t offset) {
+    const char* p = static_cast<const char*>(data);
+    while (bytes > 0) {
+        ssize_t written = pwrite(fd, p, bytes, offset);
+        if (written <= 0) return false;
+        p += written;
+        bytes -= static_cast<size_t>(written);
+        offset += written;
+    }
+    return true;
+}
+
+bool readAll(int fd, void* data, size_t bytes, off_t offset) {
+    char* p = static_cast<char*>(data);
+    while (bytes > 0) {
+        ssize_t got = pread(fd, p, bytes, offset);
+        if (got <= 0) return false;
+        p += got;
+        bytes -= static_cast<size_t>(got);
+        offset += got;
+    }
+    return true;
+}
+
+bool syncData(int fd) {
+#ifdef __linux__
+    return fdatasync(fd) == 0;
+#else
+    return fsync(fd) == 0;
+#endif
+}
+
+bool sameMetadata(const DPCheckpoint::Metadata& a, const DPCheckpoint::Metadata& b, std::string& error) {
+    if (a.datasetHash != b.datasetHash) error = "empreinte des données différente";
+    else if (a.numPoints != b.numPoints || a.dim != b.dim) error = "dimensions des données différentes";
+    else if (a.numClusters != b.numClusters) error = "nombre de clusters différent";
+    else if (a.costType != b.costType) error = "type de coût différent";
+    else if (a.maxLength != b.maxLength || a.minLength != b.minLength) error = "bornes de taille de cluster différentes";
+    else if (a.mixedPrecision != b.mixedPrecision) error = "précision différente";
+    else return true;
+    return false;
+}
+
+}
+
+uint64_t DPCheckpoint::hashPoints(const std::vector<double>& points) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(points.data());
+    for (size_t i = 0; i < points.size() * sizeof(double); i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+/**
+ * Loads the completed rows of a checkpoint into the DP table
+ *
+ * @param path Checkpoint file
+ * @param expected Metadata of the current solve
+ * @param table DP table (K x N), rows [0, completedRows) are overwritten
+ * @param completedRows Output: number of rows restored
+ * @param error Output: reason of the rejection
+ * @return true if the checkpoint matches and was read entirely
+ */
+bool DPCheckpoint::load(const std::string& path, const Metadata& expected, MatrixDouble& table,
+                        size_t& completedRows, std::string& error) {
+    completedRows = 0;
+    int file = ::open(path.c_str(), O_RDONLY);
+    if (file < 0) {
+        error = "fichier illisible";
+        return false;
+    }
+
+    Header stored;
+    bool ok = readAll(file, &stored, sizeof(Header), 0);
+    if (!ok || std::memcmp(stored.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        error = "en-tête invalide";
+        ::close(file);
+        return false;
+    }
+    if (!sameMetadata(stored.metadata, expected, error)) {
+        ::close(file);
+        return false;
+    }
+    if (stored.completedRows > table.getRows()) {
+        error = "nombre de lignes incohérent";
+        ::close(file);
+        return false;
+    }
+
+    size_t rowBytes = table.getCols() * sizeof(double);
+    for (size_t k = 0; k < stored.completedRows; k++) {
+        if (!readAll(file, table.getRow(k), rowBytes, static_cast<off_t>(sizeof(Header) + k * rowBytes))) {
+            error = "lignes tronquées";
+            ::close(file);
+            return false;
+        }
+    }
+
+    ::close(file);
+    completedRows = stored.completedRows;
+    return true;
+}
+
+bool DPCheckpoint::open(const std::string& path, const Metadata& metadata, const MatrixDouble& table,
+                        size_t existingRows) {
+    close();
+
+    int flags = O_WRONLY | O_CREAT | (existingRows == 0 ? O_TRUNC : 0);
+    fd = ::open(path.c_str(), flags, 0644);
+    if (fd < 0) return false;
+
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.metadata = metadata;
+    header.completedRows = existingRows;
+    dp = &table;
+    rowsWritten = existingRows;
+
+    if (existingRows == 0 && !writeAll(fd, &header, sizeof(Header), 0)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void DPCheckpoint::close() {
+    if (writer.joinable()) writer.join();
+    if (fd >= 0) ::close(fd);
+    fd = -1;
+    dp = nullptr;
+    busy = false;
+}
+
+/**
+ * Starts writing the rows completed since the last checkpoint on a background
+ * thread. Never waits: if the previous write is still running the request is
+ * dropped and the rows will be part of the next one
+ *
+ * @param completedRows Rows [0, completedRows) are final and will not be modified
+ * @return true if a write was started
+ */
+bool DPCheckpoint::requestAsync(size_t completedRows) {
+    if (fd < 0 || busy || completedRows <= rowsWritten) return false;
+    if (writer.joinable()) writer.join(); // Écriture précédente terminée
+
+    busy = true;
+    writer = std::thread(&DPCheckpoint::writeRows, this, rowsWritten.load(), completedRows);
+    return true;
+}
+
+// Lignes d'abord, en-tête ensuite : l'en-tête ne référence que des lignes déjà sur disque
+void DPCheckpoint::writeRows(size_t from, size_t to) {
+    size_t rowBytes = dp->getCols() * sizeof(double);
+    bool ok = true;
+    for (size_t k = from; k < to && ok; k++) {
+        ok = writeAll(fd, dp->getRow(k), rowBytes, static_cast<off_t>(sizeof(Header) + k * rowBytes));
+    }
+    ok = ok && syncData(fd);
+
+    if (ok) {
+        header.completedRows = to;
+        ok = writeAll(fd, &header, sizeof(Header), 0) && syncData(fd);
+    }
+    if (ok) rowsWritten = to;
+    busy = false;
+}
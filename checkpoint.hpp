@@ -0,0 +1,68 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include "matrixDouble.hpp"
+
+/**
+ * Point de reprise d'un remplissage DP : un en-tête (empreinte des données,
+ * dimensions, type de coût, nombre de lignes complètes) suivi des lignes
+ * terminées de la table. Les lignes sont ajoutées par un thread d'arrière-plan
+ * qui lit directement les lignes déjà calculées (elles ne changent plus),
+ * puis l'en-tête est mis à jour : une interruption laisse un fichier cohérent.
+ */
+class DPCheckpoint {
+public:
+    struct Metadata {
+        uint64_t datasetHash;
+        uint64_t numPoints;
+        uint64_t dim;
+        uint64_t numClusters;
+        uint32_t costType;   // 0 : distance carrée (k-medoids), 1 : distance (p-median)
+        uint32_t maxLength;
+        uint32_t minLength;
+        uint32_t mixedPrecision;
+    };
+
+    DPCheckpoint() : fd(-1), dp(nullptr), rowsWritten(0), busy(false) {}
+    ~DPCheckpoint() { close(); }
+
+    DPCheckpoint(const DPCheckpoint&) = delete;
+    DPCheckpoint& operator=(const DPCheckpoint&) = delete;
+
+    // Empreinte FNV-1a des coordonnées
+    static uint64_t hashPoints(const std::vector<double>& points);
+
+    // Charge les lignes complètes d'un point de reprise compatible avec expected dans table ;
+    // renvoie false avec la raison dans error sinon
+    static bool load(const std::string& path, const Metadata& expected, MatrixDouble& table,
+                     size_t& completedRows, std::string& error);
+
+    // Ouvre path pour la table table ; existingRows lignes sont déjà écrites (reprise), sinon le fichier est recréé
+    bool open(const std::string& path, const Metadata& metadata, const MatrixDouble& table, size_t existingRows = 0);
+    void close();
+    bool isOpen() const { return fd >= 0; }
+
+    // Lance l'écriture des lignes [0, completedRows) en arrière-plan, sauf si une écriture est en cours
+    bool requestAsync(size_t completedRows);
+    size_t getRowsWritten() const { return rowsWritten; }
+
+private:
+    struct Header {
+        char magic[8];
+        Metadata metadata;
+        uint64_t completedRows;
+    };
+
+    int fd;
+    Header header;
+    const MatrixDouble* dp;
+    std::atomic<size_t> rowsWritten;
+    std::atomic<bool> busy;
+    std::thread writer;
+
+    void writeRows(size_t from, size_t to);
+};
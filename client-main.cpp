@@ -0,0 +1,107 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// Lit une ligne terminée par '\n' (sans le '\n'), false si la connexion est fermée
+static bool readLine(int fd, std::string& pending, std::string& line) {
+    size_t end;
+    char buffer[4096];
+    while ((end = pending.find('\n')) == std::string::npos) {
+        ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+        if (n <= 0) return false;
+        pending.append(buffer, static_cast<size_t>(n));
+    }
+    line = pending.substr(0, end);
+    pending.erase(0, end + 1);
+    return true;
+}
+
+// Envoie une requête et lit sa réponse complète ("OK n" et n lignes, ou "ERR ...")
+static bool exchange(int fd, std::string& pending, const std::string& request, std::vector<std::string>& response) {
+    std::string data = request + "\n";
+    if (send(fd, data.data(), data.size(), MSG_NOSIGNAL) != static_cast<ssize_t>(data.size())) return false;
+
+    response.clear();
+    std::string line;
+    if (!readLine(fd, pending, line)) return false;
+    response.push_back(line);
+    if (line.compare(0, 3, "OK ") != 0) return true;
+
+    size_t count = std::strtoul(line.c_str() + 3, nullptr, 10);
+    for (size_t i = 0; i < count; i++) {
+        if (!readLine(fd, pending, line)) return false;
+        response.push_back(line);
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <socket> [-n répétitions] [requête...]" << std::endl;
+        std::cerr << "  sans requête en argument, une requête par ligne sur l'entrée standard" << std::endl;
+        return 1;
+    }
+
+    size_t repetitions = 1;
+    std::vector<std::string> requests;
+    for (int i = 2; i < argc; i++) {
+        if (std::string(argv[i]) == "-n" && i + 1 < argc) repetitions = std::max<size_t>(1, std::strtoul(argv[++i], nullptr, 10));
+        else requests.push_back(argv[i]);
+    }
+    if (requests.empty()) {
+        for (std::string line; std::getline(std::cin, line);) {
+            if (!line.empty()) requests.push_back(line);
+        }
+    }
+
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, argv[1], sizeof(address.sun_path) - 1);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+        std::cerr << "Erreur: connexion à " << argv[1] << " impossible (" << std::strerror(errno) << ")" << std::endl;
+        return 1;
+    }
+
+    std::string pending;
+    std::vector<std::string> response;
+    std::vector<double> latencies;
+    bool failed = false, closed = false;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < repetitions && !closed; r++) {
+        for (const std::string& request : requests) {
+            auto sent = std::chrono::steady_clock::now();
+            if (!exchange(fd, pending, request, response)) {
+                std::cerr << "Erreur: connexion fermée par le service" << std::endl;
+                failed = closed = true;
+                break;
+            }
+            latencies.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - sent).count());
+            if (response[0].compare(0, 3, "ERR") == 0) failed = true;
+            // Avec -n, seule la première série de réponses est affichée
+            if (r == 0) {
+                for (const std::string& line : response) std::cout << line << std::endl;
+            }
+        }
+    }
+    double total = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    close(fd);
+
+    if (repetitions > 1 && !latencies.empty()) {
+        std::sort(latencies.begin(), latencies.end());
+        std::cerr << latencies.size() << " requêtes en " << total << " s (" << latencies.size() / total << " req/s), latence ms"
+                  << " min " << 1000.0 * latencies.front()
+                  << " médiane " << 1000.0 * latencies[latencies.size() / 2]
+                  << " max " << 1000.0 * latencies.back() << std::endl;
+    }
+    return failed ? 1 : 0;
+}
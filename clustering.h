@@ -0,0 +1,83 @@
+#ifndef CLUSTERING_H
+#define CLUSTERING_H
+
+/*
+ * Interface C de libclustering : résolution par intervalles sur des points fournis
+ * par l'appelant (pointeur, N, D, pas entre deux points), résultats écrits dans des
+ * tampons de l'appelant. Aucun fichier n'est lu ni écrit.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    CLUSTERING_MEDOIDS = 0,  /* k-medoids, distance carrée (MedoidsDP) */
+    CLUSTERING_MEDIAN = 1,   /* p-median, distance (MedianDP) */
+    CLUSTERING_KMEANS = 2,   /* k-means par intervalles (KMeansDP) */
+    CLUSTERING_KCENTER = 3   /* plus grand rayon minimal (KCenter) */
+} clustering_criterion;
+
+enum {
+    CLUSTERING_OK = 0,
+    CLUSTERING_ERROR_ARGUMENT = -1,  /* tampon nul, N, D, pas, K ou options invalides */
+    CLUSTERING_ERROR_SOLVE = -2,     /* le solveur n'a pas produit de solution */
+    CLUSTERING_ERROR_INTERNAL = -3   /* exception (mémoire, ...) */
+};
+
+typedef struct {
+    uint32_t max_cluster_length;     /* 0 : non borné */
+    uint32_t min_cluster_length;     /* 0 ou 1 : pas de minimum */
+    size_t distance_matrix_budget;   /* octets, 0 : pas de matrice des distances */
+    int tiled_fill;                  /* remplissage DP par tuiles (0 par défaut) */
+    int wavefront_fill;              /* lignes DP en pipeline (0 par défaut) */
+    int quiet;                       /* coupe les traces du solveur, sans toucher à std::cout (0 par défaut) */
+} clustering_options;
+
+/*
+ * Tampons de sortie, tous facultatifs (NULL : non rempli). Les intervalles sont
+ * donnés en positions dans l'ordre trié par première coordonnée ; sorted_index[p]
+ * est l'indice (dans le tampon d'entrée) du point en position p.
+ */
+typedef struct {
+    uint32_t* interval_first;  /* K valeurs */
+    uint32_t* interval_last;   /* K valeurs, bornes incluses */
+    size_t* labels;            /* N valeurs dans l'ordre d'entrée, 1..K */
+    size_t* sorted_index;      /* N valeurs */
+    double* cost;              /* 1 valeur */
+} clustering_result;
+
+void clustering_default_options(clustering_options* options);
+
+/*
+ * options peut être NULL (valeurs par défaut) ; renvoie CLUSTERING_OK ou un code d'erreur. Bornes de longueur,
+ * matrice des distances et modes de remplissage ne s'appliquent qu'à MEDOIDS et MEDIAN : avec KMEANS ou KCENTER,
+ * une valeur différente de celle de clustering_default_options donne CLUSTERING_ERROR_ARGUMENT.
+ */
+int clustering_solve(const double* points, size_t n, size_t dim, size_t stride, size_t k,
+                     clustering_criterion criterion, const clustering_options* options,
+                     const clustering_result* result);
+
+/* Appelé sur un thread du pool de la bibliothèque à la fin d'un solve asynchrone ; error ("" si aucune) est valable pendant l'appel */
+typedef void (*clustering_callback)(int status, const char* error, void* user_data);
+
+/*
+ * Soumet le solve au pool de la bibliothèque (les solves simultanés se partagent les threads) et rend aussitôt
+ * CLUSTERING_OK, ou un code d'erreur si la soumission échoue. points et les tampons de result doivent rester
+ * valides jusqu'à l'appel de done (qui peut être NULL) ; options et result sont copiés.
+ */
+int clustering_solve_async(const double* points, size_t n, size_t dim, size_t stride, size_t k,
+                           clustering_criterion criterion, const clustering_options* options,
+                           const clustering_result* result, clustering_callback done, void* user_data);
+
+/* Message de la dernière erreur du thread appelant ("" si aucune), valable jusqu'au prochain clustering_solve du même thread */
+const char* clustering_last_error(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,260 @@
+#include "clusteringApi.hpp"
+#include "medoidsDP.hpp"
+#include "medianDP.hpp"
+#include "kmeansDP.hpp"
+#include "kcenter.hpp"
+#include "solverPool.hpp"
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include <new>
+#include <memory>
+#include <exception>
+
+namespace clustering {
+
+namespace {
+
+int fail(int code, const std::string& message, std::string* error) {
+    if (error) *error = message;
+    return code;
+}
+
+/**
+ * Copies the solution of an interval solver into the caller buffers: labels
+ * go back to the input order through the sort permutation
+ */
+int exportResult(const SolverInterval& solver, const vector<size_t>& order, size_t k,
+                 const ResultBuffers& result, std::string* error) {
+    const auto& intervals = solver.getSolutionIntervals();
+    const auto& labels = solver.getSolution();
+    if (intervals.size() != k || labels.size() != order.size()) {
+        return fail(CLUSTERING_ERROR_SOLVE, "le solveur n'a pas produit de solution", error);
+    }
+
+    for (size_t c = 0; c < k; c++) {
+        if (result.intervalFirst) result.intervalFirst[c] = intervals[c].first;
+        if (result.intervalLast) result.intervalLast[c] = intervals[c].second;
+    }
+    for (size_t p = 0; p < order.size(); p++) {
+        if (result.labels) result.labels[order[p]] = labels[p];
+        if (result.sortedIndex) result.sortedIndex[p] = order[p];
+    }
+    if (result.cost) *result.cost = solver.getSolutionCost();
+    return CLUSTERING_OK;
+}
+
+/**
+ * Copies the points into the solver in sorted order; quiet cuts the traces
+ * of this solver only, std::cout is left alone
+ */
+void loadPoints(Solver& solver, const PointView& points, const vector<size_t>& order, size_t k,
+                const Options& options) {
+    solver.setPoints(points.data, points.n, points.dim, points.stride, order.data());
+    solver.setNbClusters(k);
+    if (options.quiet) solver.setLogStream(nullptr);
+}
+
+void configureDP(SolverDP& solver, const Options& options) {
+    solver.setClusterLengthBounds(options.maxClusterLength, std::max<uint32_t>(1, options.minClusterLength));
+    solver.setDistanceMatrixBudget(options.distanceMatrixBudget);
+    solver.setFillTiling(options.tiledFill);
+    solver.setWavefrontFill(options.wavefrontFill);
+}
+
+/**
+ * Name of the first option that only the DP solvers (MEDOIDS, MEDIAN) apply,
+ * or nullptr when the options are the defaults for KMEANS and KCENTER
+ */
+const char* dpOnlyOption(const Options& options) {
+    if (options.maxClusterLength > 0 || options.minClusterLength > 1) return "les bornes de longueur des clusters";
+    if (options.distanceMatrixBudget > 0) return "la matrice des distances";
+    if (options.tiledFill || options.wavefrontFill) return "le remplissage par tuiles ou en pipeline";
+    return nullptr;
+}
+
+} // namespace
+
+/**
+ * Solves one interval clustering on the caller's points. The sort
+ * permutation by first coordinate (stable, skipped when the points are
+ * already sorted) drives the single copy of the points into the solver,
+ * which then finds its input sorted and does not sort again
+ */
+int solve(const PointView& points, size_t k, Criterion criterion, const Options& options,
+          const ResultBuffers& result, std::string* error) {
+    if (!points.data || points.n == 0 || points.dim == 0 || points.stride < points.dim) {
+        return fail(CLUSTERING_ERROR_ARGUMENT, "tampon de points invalide (pointeur, N, D ou pas)", error);
+    }
+    if (k == 0 || k > points.n) {
+        return fail(CLUSTERING_ERROR_ARGUMENT, "K doit être dans [1, N]", error);
+    }
+    if (criterion == Criterion::KMEANS || criterion == Criterion::KCENTER) {
+        if (const char* option = dpOnlyOption(options)) {
+            return fail(CLUSTERING_ERROR_ARGUMENT, std::string("option non prise en charge par ce critère : ") + option,
+                        error);
+        }
+    }
+
+    try {
+        vector<size_t> order(points.n);
+        std::iota(order.begin(), order.end(), 0);
+        auto first = [&points](size_t i) { return points.data[i * points.stride]; };
+        bool sorted = true;
+        for (size_t i = 1; i < points.n && sorted; i++) sorted = first(i - 1) <= first(i);
+        if (!sorted) {
+            std::stable_sort(order.begin(), order.end(), [&first](size_t a, size_t b) { return first(a) < first(b); });
+        }
+
+        switch (criterion) {
+            case Criterion::MEDOIDS: {
+                MedoidsDP solver;
+                loadPoints(solver, points, order, k, options);
+                configureDP(solver, options);
+                solver.solve();
+                return exportResult(solver, order, k, result, error);
+            }
+            case Criterion::MEDIAN: {
+                MedianDP solver;
+                loadPoints(solver, points, order, k, options);
+                configureDP(solver, options);
+                solver.solve();
+                return exportResult(solver, order, k, result, error);
+            }
+            case Criterion::KMEANS: {
+                KMeansDP solver;
+                loadPoints(solver, points, order, k, options);
+                solver.solve();
+                return exportResult(solver, order, k, result, error);
+            }
+            case Criterion::KCENTER: {
+                KCenter solver;
+                loadPoints(solver, points, order, k, options);
+                solver.solve();
+                return exportResult(solver, order, k, result, error);
+            }
+        }
+        return fail(CLUSTERING_ERROR_ARGUMENT, "critère inconnu", error);
+    } catch (const std::bad_alloc&) {
+        return fail(CLUSTERING_ERROR_INTERNAL, "mémoire insuffisante", error);
+    } catch (const std::exception& e) {
+        return fail(CLUSTERING_ERROR_INTERNAL, e.what(), error);
+    }
+}
+
+/**
+ * Queues the solve on the shared pool, where it runs with its share of the
+ * OpenMP threads. The options and buffer pointers are copied at submission.
+ * An exception thrown by done is handed to the future instead of escaping
+ * into the pool thread, so the future is always made ready
+ */
+std::future<SolveStatus> solveAsync(const PointView& points, size_t k, Criterion criterion, const Options& options,
+                                    const ResultBuffers& result, CompletionCallback done) {
+    auto promise = std::make_shared<std::promise<SolveStatus>>();
+    std::future<SolveStatus> status = promise->get_future();
+
+    SolverPool::shared().submit([=]() {
+        SolveStatus outcome;
+        outcome.code = solve(points, k, criterion, options, result, &outcome.error);
+        try {
+            if (done) done(outcome);
+        } catch (...) {
+            promise->set_exception(std::current_exception());
+            return;
+        }
+        promise->set_value(std::move(outcome));
+    });
+    return status;
+}
+
+} // namespace clustering
+
+namespace {
+
+thread_local std::string lastError;
+
+clustering::Options toOptions(const clustering_options* options) {
+    clustering::Options cppOptions;
+    if (options) {
+        cppOptions.maxClusterLength = options->max_cluster_length;
+        cppOptions.minClusterLength = options->min_cluster_length;
+        cppOptions.distanceMatrixBudget = options->distance_matrix_budget;
+        cppOptions.tiledFill = options->tiled_fill != 0;
+        cppOptions.wavefrontFill = options->wavefront_fill != 0;
+        cppOptions.quiet = options->quiet != 0;
+    }
+    return cppOptions;
+}
+
+clustering::ResultBuffers toBuffers(const clustering_result* result) {
+    clustering::ResultBuffers buffers;
+    if (result) {
+        buffers.intervalFirst = result->interval_first;
+        buffers.intervalLast = result->interval_last;
+        buffers.labels = result->labels;
+        buffers.sortedIndex = result->sorted_index;
+        buffers.cost = result->cost;
+    }
+    return buffers;
+}
+
+bool isKnownCriterion(clustering_criterion criterion) {
+    return criterion >= CLUSTERING_MEDOIDS && criterion <= CLUSTERING_KCENTER;
+}
+
+}
+
+extern "C" {
+
+void clustering_default_options(clustering_options* options) {
+    if (!options) return;
+    clustering::Options defaults;
+    options->max_cluster_length = defaults.maxClusterLength;
+    options->min_cluster_length = defaults.minClusterLength;
+    options->distance_matrix_budget = defaults.distanceMatrixBudget;
+    options->tiled_fill = defaults.tiledFill ? 1 : 0;
+    options->wavefront_fill = defaults.wavefrontFill ? 1 : 0;
+    options->quiet = defaults.quiet ? 1 : 0;
+}
+
+int clustering_solve(const double* points, size_t n, size_t dim, size_t stride, size_t k,
+                     clustering_criterion criterion, const clustering_options* options,
+                     const clustering_result* result) {
+    lastError.clear();
+    if (!isKnownCriterion(criterion)) {
+        lastError = "critère inconnu";
+        return CLUSTERING_ERROR_ARGUMENT;
+    }
+
+    clustering::PointView view{points, n, dim, stride};
+    return clustering::solve(view, k, static_cast<clustering::Criterion>(criterion), toOptions(options),
+                             toBuffers(result), &lastError);
+}
+
+int clustering_solve_async(const double* points, size_t n, size_t dim, size_t stride, size_t k,
+                           clustering_criterion criterion, const clustering_options* options,
+                           const clustering_result* result, clustering_callback done, void* user_data) {
+    lastError.clear();
+    if (!isKnownCriterion(criterion)) {
+        lastError = "critère inconnu";
+        return CLUSTERING_ERROR_ARGUMENT;
+    }
+
+    try {
+        clustering::PointView view{points, n, dim, stride};
+        clustering::solveAsync(view, k, static_cast<clustering::Criterion>(criterion), toOptions(options),
+                               toBuffers(result), [done, user_data](const clustering::SolveStatus& status) {
+            if (done) done(status.code, status.error.c_str(), user_data);
+        });
+    } catch (const std::exception& e) {
+        lastError = e.what();
+        return CLUSTERING_ERROR_INTERNAL;
+    }
+    return CLUSTERING_OK;
+}
+
+const char* clustering_last_error(void) {
+    return lastError.c_str();
+}
+
+}
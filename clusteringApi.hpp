@@ -0,0 +1,63 @@
+#pragma once
+#include <string>
+#include <future>
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+#include "clustering.h"
+
+/**
+ * Interface C++ de libclustering (l'interface C de clustering.h s'appuie dessus).
+ * Les points sont lus dans le tampon de l'appelant et copiés une seule fois dans
+ * le solveur, directement dans l'ordre trié qu'il attend ; le tampon n'est pas
+ * conservé et les résultats sont écrits dans les tampons fournis.
+ */
+namespace clustering {
+
+enum class Criterion { MEDOIDS, MEDIAN, KMEANS, KCENTER };
+
+// Point i : data[i * stride + d], d < dim
+struct PointView {
+    const double* data;
+    size_t n;
+    size_t dim;
+    size_t stride;
+};
+
+// Seuls MEDOIDS et MEDIAN appliquent les bornes, la matrice et les modes de remplissage : KMEANS et KCENTER
+// refusent (CLUSTERING_ERROR_ARGUMENT) toute valeur différente de la valeur par défaut
+struct Options {
+    uint32_t maxClusterLength = 0;  // 0 : non borné
+    uint32_t minClusterLength = 1;  // 0 ou 1 : pas de minimum, appliqué aussi sans maximum
+    size_t distanceMatrixBudget = 0;
+    bool tiledFill = false;
+    bool wavefrontFill = false;
+    bool quiet = false;             // Coupe les traces du solveur (Solver::setLogStream), std::cout n'est pas touché
+};
+
+// Tampons facultatifs (nullptr : non rempli), mêmes tailles que clustering_result
+struct ResultBuffers {
+    uint32_t* intervalFirst = nullptr;
+    uint32_t* intervalLast = nullptr;
+    size_t* labels = nullptr;
+    size_t* sortedIndex = nullptr;
+    double* cost = nullptr;
+};
+
+// Renvoie CLUSTERING_OK ou un code CLUSTERING_ERROR_*, avec le message dans error s'il est fourni
+int solve(const PointView& points, size_t k, Criterion criterion, const Options& options,
+          const ResultBuffers& result, std::string* error = nullptr);
+
+struct SolveStatus {
+    int code;           // CLUSTERING_OK ou CLUSTERING_ERROR_*
+    std::string error;
+};
+typedef std::function<void(const SolveStatus&)> CompletionCallback;
+
+// Soumet le solve au pool de la bibliothèque (SolverPool::shared) et rend aussitôt la main. Les points et les
+// tampons doivent rester valides jusqu'à la fin ; done est appelé sur le thread du pool, avant que le futur soit prêt.
+// Si done lève une exception, le futur la relance (get) au lieu de rendre le statut
+std::future<SolveStatus> solveAsync(const PointView& points, size_t k, Criterion criterion, const Options& options,
+                                    const ResultBuffers& result, CompletionCallback done = nullptr);
+
+} // namespace clustering
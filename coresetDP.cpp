@@ -0,0 +1,605 @@
+#include "coresetDP.hpp"
+#include "splitKernels.hpp"
+#include <iostream>
+#include <limits>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+void CoresetDP::setCoresetSize(size_t initialSize, size_t maxSize) {
+    initialCoresetSize = std::max<size_t>(1, initialSize);
+    maxCoresetSize = std::max(initialCoresetSize, maxSize);
+}
+
+/**
+ * Approximate solve: builds a coreset of targetSize groups, solves the DP on the
+ * groups, refines the boundaries and centers on the full data, and doubles the
+ * coreset size while the total spread of the groups exceeds epsilon times the
+ * cost. Finally computes the lower bound of the optimal interval cost
+ */
+void CoresetDP::solve() {
+    if (N == 0 || K == 0 || K > N) {
+        std::cerr << "Erreur: impossible de partitionner " << N << " points en " << K << " clusters" << std::endl;
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    resort();
+
+    size_t target = std::min(N, std::max(initialCoresetSize, 4 * K));
+    size_t limit = std::min(N, std::max(maxCoresetSize, target));
+    report = CoresetReport{0, 0.0, 0.0, 0.0, 0.0, 0.0, false, 0, 0.0};
+
+    vector<pair<uint, uint>> intervals;
+    vector<size_t> centers;
+    while (true) {
+        buildCoreset(target);
+        computePrefixSums();
+        report.rounds++;
+        report.coresetSize = groupStart.size() - 1;
+        if (report.coresetSize < K) {
+            std::cerr << "Erreur: " << report.coresetSize << " points distincts pour " << K << " clusters" << std::endl;
+            return;
+        }
+        report.coresetError = 0.0;
+        for (double spread : groupSpread) report.coresetError += spread;
+
+        report.coresetCost = solveCoreset(intervals, centers);
+        report.cost = refine(intervals, centers);
+        report.errorWithinEpsilon = report.coresetError <= epsilon * report.cost;
+
+        trace() << "Coreset: " << report.coresetSize << " groupes, dispersion " << report.coresetError
+                  << ", coût DP " << report.coresetCost << ", coût affiné " << report.cost << std::endl;
+        if (report.errorWithinEpsilon || target >= limit) break;
+        target = std::min(limit, 2 * target);
+    }
+
+    report.lowerBound = lowerBound();
+    report.ratio = report.lowerBound > 0.0 ? report.cost / report.lowerBound
+                                           : (report.cost > 0.0 ? std::numeric_limits<double>::infinity() : 1.0);
+    report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    solutionInterval = intervals;
+    intervalCenters = centers;
+    solution.assign(N, 0);
+    computeSolutionFromIntervals();
+    solutionCost = report.cost;
+
+    trace() << "Solve approché (" << (squared ? "k-medoids" : "p-median") << "): coût " << report.cost
+              << ", borne inférieure " << report.lowerBound << ", ratio " << report.ratio
+              << (report.errorWithinEpsilon ? "" : " (dispersion du coreset > epsilon)") << ", "
+              << report.seconds << " s" << std::endl;
+}
+
+double CoresetDP::pointDistance(size_t i, const double* center) const {
+    double result = 0.0;
+    for (size_t dim = 0; dim < D; dim++) {
+        double diff = getCoordinate(i, dim) - center[dim];
+        result += diff * diff;
+    }
+    return squared ? result : std::sqrt(result);
+}
+
+// Dispersion d'un groupe autour de son centroïde : SSE, ou sqrt(n SSE) >= somme des distances
+double CoresetDP::spreadOf(double count, double sse) const {
+    return squared ? sse : std::sqrt(count * sse);
+}
+
+/**
+ * Greedy pass along the sorted points for a spread threshold: a point joins
+ * the current group unless the spread of the group would exceed threshold.
+ * The centroid and SSE are updated incrementally (Welford), in O(D) per point
+ *
+ * @param starts Output if not null: first point of each group
+ * @return Number of groups
+ */
+size_t CoresetDP::countGroups(double threshold, vector<size_t>* starts) const {
+    vector<double> mean(D);
+    size_t groups = 0;
+    double count = 0.0, sse = 0.0;
+
+    for (size_t i = 0; i < N; i++) {
+        double added = 0.0;
+        if (count > 0.0) {
+            for (size_t dim = 0; dim < D; dim++) {
+                double diff = getCoordinate(i, dim) - mean[dim];
+                added += diff * diff * count / (count + 1.0);
+            }
+        }
+        if (count == 0.0 || spreadOf(count + 1.0, sse + added) > threshold) {
+            groups++;
+            if (starts) starts->push_back(i);
+            count = 0.0;
+            sse = 0.0;
+            added = 0.0;
+            std::fill(mean.begin(), mean.end(), 0.0);
+        }
+        count += 1.0;
+        sse += added;
+        for (size_t dim = 0; dim < D; dim++) {
+            mean[dim] += (getCoordinate(i, dim) - mean[dim]) / count;
+        }
+    }
+    return groups;
+}
+
+void CoresetDP::buildGroups(double threshold) {
+    groupStart.clear();
+    countGroups(threshold, &groupStart);
+    groupStart.push_back(N);
+
+    size_t M = groupStart.size() - 1;
+    groupCentroids.assign(M * D, 0.0);
+    groupSpread.assign(M, 0.0);
+    representative.assign(M, 0);
+
+#pragma omp parallel for if(N > 100000) schedule(static)
+    for (size_t g = 0; g < M; g++) {
+        size_t first = groupStart[g], last = groupStart[g + 1];
+        double* centroid = &groupCentroids[g * D];
+        for (size_t i = first; i < last; i++) {
+            for (size_t dim = 0; dim < D; dim++) centroid[dim] += getCoordinate(i, dim);
+        }
+        for (size_t dim = 0; dim < D; dim++) centroid[dim] /= static_cast<double>(last - first);
+
+        double groupSSE = 0.0, nearest = std::numeric_limits<double>::max();
+        for (size_t i = first; i < last; i++) {
+            double dist = 0.0;
+            for (size_t dim = 0; dim < D; dim++) {
+                double diff = getCoordinate(i, dim) - centroid[dim];
+                dist += diff * diff;
+            }
+            groupSSE += dist;
+            if (dist < nearest) {
+                nearest = dist;
+                representative[g] = i;
+            }
+        }
+        groupSpread[g] = spreadOf(static_cast<double>(last - first), groupSSE);
+    }
+}
+
+/**
+ * Builds the coreset with at most targetSize groups: the spread threshold is the
+ * smallest one (bisection on a log scale) whose greedy pass gives targetSize
+ * groups or fewer
+ */
+void CoresetDP::buildCoreset(size_t targetSize) {
+    double high = std::numeric_limits<double>::max();
+    {
+        // Dispersion de l'ensemble complet : un seul groupe au-delà
+        vector<double> mean(D, 0.0);
+        for (size_t i = 0; i < N; i++) {
+            for (size_t dim = 0; dim < D; dim++) mean[dim] += getCoordinate(i, dim);
+        }
+        for (size_t dim = 0; dim < D; dim++) mean[dim] /= static_cast<double>(N);
+        double sse = 0.0;
+        for (size_t i = 0; i < N; i++) {
+            for (size_t dim = 0; dim < D; dim++) {
+                double diff = getCoordinate(i, dim) - mean[dim];
+                sse += diff * diff;
+            }
+        }
+        high = 2.0 * spreadOf(static_cast<double>(N), sse) + 1.0;
+    }
+
+    double low = 0.0;
+    if (countGroups(low) > targetSize) {
+        double lowPositive = high * 1e-16;
+        for (int iteration = 0; iteration < 40; iteration++) {
+            double middle = std::sqrt(lowPositive * high);
+            if (countGroups(middle) > targetSize) lowPositive = middle;
+            else high = middle;
+        }
+        low = high;
+    }
+    buildGroups(low);
+}
+
+void CoresetDP::computePrefixSums() {
+    size_t M = groupStart.size() - 1;
+    prefixSums.assign((M + 1) * D, 0.0);
+    prefixSquares.assign(M + 1, 0.0);
+    for (size_t g = 0; g < M; g++) {
+        double squares = 0.0;
+        for (size_t dim = 0; dim < D; dim++) prefixSums[(g + 1) * D + dim] = prefixSums[g * D + dim];
+        for (size_t i = groupStart[g]; i < groupStart[g + 1]; i++) {
+            for (size_t dim = 0; dim < D; dim++) {
+                double x = getCoordinate(i, dim);
+                prefixSums[(g + 1) * D + dim] += x;
+                squares += x * x;
+            }
+        }
+        prefixSquares[g + 1] = prefixSquares[g] + squares;
+    }
+
+    // Abscisse curviligne des centroïdes le long de leur ligne brisée, pondérée par les tailles
+    arcLength.assign(M, 0.0);
+    prefixArc.assign(M + 1, 0.0);
+    for (size_t g = 0; g < M; g++) {
+        if (g > 0) {
+            double dist = 0.0;
+            for (size_t dim = 0; dim < D; dim++) {
+                double diff = groupCentroids[g * D + dim] - groupCentroids[(g - 1) * D + dim];
+                dist += diff * diff;
+            }
+            arcLength[g] = arcLength[g - 1] + std::sqrt(dist);
+        }
+        prefixArc[g + 1] = prefixArc[g] + static_cast<double>(groupStart[g + 1] - groupStart[g]) * arcLength[g];
+    }
+
+    prefixFirst.assign(N + 1, 0.0);
+    prefixAbsFirst.assign(N + 1, 0.0);
+    for (size_t i = 0; i < N; i++) {
+        prefixFirst[i + 1] = prefixFirst[i] + getCoordinate(i, 0);
+        prefixAbsFirst[i + 1] = prefixAbsFirst[i] + std::fabs(getCoordinate(i, 0));
+    }
+
+    // Front 2D : la seconde coordonnée est monotone le long de la première, triée elle aussi
+    secondDirection = 0.0;
+    prefixSecond.clear();
+    if (D != 2 || N < 2) return;
+    bool increasing = true, decreasing = true;
+    for (size_t i = 1; i < N; i++) {
+        increasing = increasing && getCoordinate(i, 1) >= getCoordinate(i - 1, 1);
+        decreasing = decreasing && getCoordinate(i, 1) <= getCoordinate(i - 1, 1);
+    }
+    if (!increasing && !decreasing) return;
+    secondDirection = increasing ? 1.0 : -1.0;
+    prefixSecond.assign(N + 1, 0.0);
+    prefixAbsSecond.assign(N + 1, 0.0);
+    for (size_t i = 0; i < N; i++) {
+        prefixSecond[i + 1] = prefixSecond[i] + secondDirection * getCoordinate(i, 1);
+        prefixAbsSecond[i + 1] = prefixAbsSecond[i] + std::fabs(getCoordinate(i, 1));
+    }
+}
+
+/**
+ * Cost of the points of groups [a, b] around a group representative, in
+ * O(D + log M) from the prefix sums. With squared distances, the sum over all
+ * points is SSE + n|mean - r|²; the representative closest to the mean is
+ * found by descent from the group holding the middle point. With distances,
+ * the sum is estimated along the polyline through the group centroids (exact
+ * where the front is straight, an overestimate elsewhere since a chord is
+ * shorter than its arc): the center is the weighted median group
+ *
+ * @param center Output: index of the chosen representative
+ */
+double CoresetDP::groupIntervalCost(size_t a, size_t b, size_t& center) const {
+    size_t first = groupStart[a], last = groupStart[b + 1];
+    double count = static_cast<double>(last - first);
+
+    // Groupe du point médian
+    size_t middle = first + (last - first - 1) / 2;
+    size_t current = static_cast<size_t>(std::upper_bound(groupStart.begin() + a, groupStart.begin() + b + 1, middle)
+                                         - groupStart.begin()) - 1;
+
+    if (!squared) {
+        center = representative[current];
+        double s = arcLength[current];
+        double leftCount = static_cast<double>(groupStart[current + 1] - first);
+        double rightCount = count - leftCount;
+        double leftArc = prefixArc[current + 1] - prefixArc[a];
+        double rightArc = prefixArc[b + 1] - prefixArc[current + 1];
+        return std::max(0.0, s * leftCount - leftArc) + std::max(0.0, rightArc - s * rightCount);
+    }
+
+    vector<double> mean(D);
+    for (size_t dim = 0; dim < D; dim++) {
+        mean[dim] = (prefixSums[(b + 1) * D + dim] - prefixSums[a * D + dim]) / count;
+    }
+    auto offset = [&](size_t g) {
+        const double* r = &points[representative[g] * D];
+        double dist = 0.0;
+        for (size_t dim = 0; dim < D; dim++) {
+            double diff = mean[dim] - r[dim];
+            dist += diff * diff;
+        }
+        return dist;
+    };
+
+    double best = offset(current);
+    while (true) {
+        double left = current > a ? offset(current - 1) : std::numeric_limits<double>::max();
+        double right = current < b ? offset(current + 1) : std::numeric_limits<double>::max();
+        if (left < best && left <= right) {
+            best = left;
+            current--;
+        } else if (right < best) {
+            best = right;
+            current++;
+        } else {
+            break;
+        }
+    }
+    center = representative[current];
+
+    double squares = prefixSquares[b + 1] - prefixSquares[a];
+    double norm = 0.0;
+    for (size_t dim = 0; dim < D; dim++) norm += mean[dim] * mean[dim];
+    return std::max(0.0, squares - count * norm) + count * best;
+}
+
+/**
+ * Lower bound of the cost of any cluster containing the points of groups
+ * [a, b]: the centroid SSE for squared distances, the larger of sqrt(SSE) and
+ * the 1D median costs of the coordinates for distances (the second one only
+ * when it is monotone along the front, hence sorted too). They only grow
+ * when points are added, and are lowered by a cancellation margin
+ */
+double CoresetDP::groupIntervalLowerBound(size_t a, size_t b) const {
+    if (a > b) return 0.0;
+
+    size_t first = groupStart[a], last = groupStart[b + 1];
+    double count = static_cast<double>(last - first);
+    double squares = prefixSquares[b + 1] - prefixSquares[a];
+    double centroidNorm = 0.0;
+    for (size_t dim = 0; dim < D; dim++) {
+        double sum = prefixSums[(b + 1) * D + dim] - prefixSums[a * D + dim];
+        centroidNorm += sum * sum;
+    }
+    double sse = squares - centroidNorm / count;
+    sse -= 1e-12 * (prefixSquares[b + 1] + prefixSquares[a]);
+    sse = std::max(0.0, sse);
+    if (squared) return sse;
+
+    // Coût médian 1D de valeurs triées : moitié haute moins moitié basse
+    size_t half = (last - first) / 2;
+    auto median1D = [&](const vector<double>& prefix, const vector<double>& prefixAbs) {
+        double lower = prefix[first + half] - prefix[first];
+        double upper = prefix[last] - prefix[last - half];
+        return upper - lower - 4e-12 * prefixAbs[last];
+    };
+
+    double bound = std::max(std::sqrt(sse), median1D(prefixFirst, prefixAbsFirst));
+    if (secondDirection != 0.0) {
+        // |v| >= (|v0| + |v1|) / sqrt(2) : les deux coûts 1D se cumulent
+        double second = median1D(prefixSecond, prefixAbsSecond);
+        bound = std::max(bound, std::max(second, (median1D(prefixFirst, prefixAbsFirst) + second) / std::sqrt(2.0)));
+    }
+    return bound;
+}
+
+/**
+ * Interval DP on the M groups, column by column: the costs of the clusters
+ * ending at group j are computed once (in parallel) and every row k takes its
+ * minimum over the splits with the SIMD argmin kernel
+ *
+ * @param intervals Output: clusters in point indices
+ * @param centers Output: representative chosen for each cluster
+ * @return DP cost of the coreset
+ */
+double CoresetDP::solveCoreset(vector<pair<uint, uint>>& intervals, vector<size_t>& centers) const {
+    size_t M = groupStart.size() - 1;
+    const double sentinel = std::numeric_limits<double>::max();
+
+    MatrixDouble dp;
+    dp.initMatrix(K, M);
+    for (size_t k = 0; k < K; k++) std::fill(dp.getRow(k), dp.getRow(k) + M, sentinel);
+    vector<uint32_t> argmins(K * M, 0);
+    vector<double> v(M);
+
+    for (size_t j = 0; j < M; j++) {
+        // v[s] : coût des groupes [s+1, j], v[j] : coût des groupes [0, j]
+#pragma omp parallel for if(j > 256) schedule(static)
+        for (size_t s = 0; s <= j; s++) {
+            size_t center;
+            v[s] = s == j ? groupIntervalCost(0, j, center) : groupIntervalCost(s + 1, j, center);
+        }
+
+        dp.getRow(0)[j] = v[j];
+        for (size_t k = 1; k < K && k <= j; k++) {
+            ArgminResult best = argminSum(dp.getRow(k - 1) + (k - 1), v.data() + (k - 1), j - (k - 1));
+            dp.getRow(k)[j] = best.value;
+            argmins[k * M + j] = static_cast<uint32_t>(k - 1 + best.index);
+        }
+    }
+
+    // Backtracking sur les groupes
+    vector<pair<size_t, size_t>> groups;
+    size_t last = M - 1;
+    for (size_t k = K - 1; k > 0; k--) {
+        size_t split = argmins[k * M + last];
+        groups.push_back(make_pair(split + 1, last));
+        last = split;
+    }
+    groups.push_back(make_pair(0, last));
+    reverse(groups.begin(), groups.end());
+
+    intervals.clear();
+    centers.clear();
+    for (const auto& g : groups) {
+        size_t center;
+        groupIntervalCost(g.first, g.second, center);
+        intervals.push_back(make_pair(static_cast<uint>(groupStart[g.first]),
+                                      static_cast<uint>(groupStart[g.second + 1] - 1)));
+        centers.push_back(center);
+    }
+    return dp.getRow(K - 1)[M - 1];
+}
+
+/**
+ * Lower bound of the optimal interval cost on the full data. Each cluster of
+ * any partition contains the groups strictly inside it, and a cost bound
+ * that only grows with the points applies to them; each cut loses at most
+ * the group it falls in. G[k][c] is the smallest sum of bounds over at most k
+ * clusters covering groups [0, c) where a group can be dropped before each
+ * cluster:
+ *     G[k][c] = min over c' <= c of P[k][c'] + bound(c', c-1)
+ *     P[k][c'] = min(G[k-1][c'], G[k-1][c'-1])
+ * and the bound is min(G[K][M], G[K][M-1])
+ */
+double CoresetDP::lowerBound() const {
+    size_t M = groupStart.size() - 1;
+    const double sentinel = std::numeric_limits<double>::max();
+
+    MatrixDouble G, P;
+    G.initMatrix(K + 1, M + 1);
+    P.initMatrix(K + 1, M + 1);
+    for (size_t k = 0; k <= K; k++) {
+        std::fill(G.getRow(k), G.getRow(k) + M + 1, sentinel);
+        std::fill(P.getRow(k), P.getRow(k) + M + 1, sentinel);
+    }
+    G.getRow(0)[0] = 0.0;
+    vector<double> w(M + 1);
+
+    for (size_t c = 0; c <= M; c++) {
+#pragma omp parallel for if(c > 256) schedule(static)
+        for (size_t first = 0; first <= c; first++) {
+            w[first] = first == c ? 0.0 : groupIntervalLowerBound(first, c - 1);
+        }
+
+        for (size_t k = 1; k <= K; k++) {
+            const double* previous = G.getRow(k - 1);
+            P.getRow(k)[c] = c > 0 ? std::min(previous[c], previous[c - 1]) : previous[c];
+            G.getRow(k)[c] = argminSum(P.getRow(k), w.data(), c + 1).value;
+        }
+    }
+
+    double bound = G.getRow(K)[M];
+    if (M > 0) bound = std::min(bound, G.getRow(K)[M - 1]);
+    return bound;
+}
+
+/**
+ * Refines the coreset solution on the full data: each boundary is moved within
+ * the two groups around it to the position minimizing the cost with the two
+ * centers fixed, then every center is recomputed on its points. Neither step
+ * increases the cost
+ *
+ * @return Cost of the refined solution on all the points
+ */
+double CoresetDP::refine(vector<pair<uint, uint>>& intervals, vector<size_t>& centers) const {
+    vector<double> costs(intervals.size(), 0.0);
+
+    for (unsigned int pass = 0; pass < refinePasses; pass++) {
+        for (size_t c = 0; c + 1 < intervals.size(); c++) {
+            refineCut(c, intervals, centers);
+        }
+
+#pragma omp parallel for schedule(dynamic)
+        for (size_t c = 0; c < intervals.size(); c++) {
+            centers[c] = bestCenter(intervals[c], centers[c], costs[c]);
+        }
+    }
+
+    if (refinePasses == 0) {
+#pragma omp parallel for schedule(dynamic)
+        for (size_t c = 0; c < intervals.size(); c++) {
+            costs[c] = intervalCost(intervals[c], centers[c]);
+        }
+    }
+
+    double total = 0.0;
+    for (double cost : costs) total += cost;
+    return total;
+}
+
+void CoresetDP::refineCut(size_t c, vector<pair<uint, uint>>& intervals, const vector<size_t>& centers) const {
+    size_t cut = intervals[c + 1].first; // Premier point du cluster c+1
+    size_t groupBefore = static_cast<size_t>(std::upper_bound(groupStart.begin(), groupStart.end(), cut - 1)
+                                             - groupStart.begin()) - 1;
+    size_t groupAfter = static_cast<size_t>(std::upper_bound(groupStart.begin(), groupStart.end(), cut)
+                                            - groupStart.begin()) - 1;
+
+    // Chaque centre reste dans son cluster : centre c < coupure <= centre c+1
+    size_t low = std::max<size_t>(groupStart[groupBefore], centers[c] + 1);
+    size_t high = std::min<size_t>(groupStart[groupAfter + 1], centers[c + 1]);
+    if (low >= high) return;
+
+    const double* left = &points[centers[c] * D];
+    const double* right = &points[centers[c + 1] * D];
+
+    // Coût relatif de la coupure t : somme sur [low, t) de d(x, gauche) - d(x, droite)
+    double running = 0.0, atCut = 0.0, best = std::numeric_limits<double>::max();
+    size_t bestCut = cut;
+    for (size_t t = low; t <= high; t++) {
+        if (t == cut) atCut = running;
+        if (running < best) {
+            best = running;
+            bestCut = t;
+        }
+        if (t < high) running += pointDistance(t, left) - pointDistance(t, right);
+    }
+    if (best >= atCut) return;
+
+    intervals[c].second = static_cast<uint>(bestCut - 1);
+    intervals[c + 1].first = static_cast<uint>(bestCut);
+}
+
+/**
+ * Best center of a cluster on the full data. With squared distances the exact
+ * medoid is the point closest to the centroid (cost SSE + n|mean - x|²), found
+ * in O(nD). With distances, the representatives of the groups inside the
+ * cluster are explored by descent from the current center, each evaluated
+ * exactly in O(nD)
+ *
+ * @param cost Output: cost of the cluster around the returned center
+ */
+size_t CoresetDP::bestCenter(const pair<uint, uint>& interval, size_t current, double& cost) const {
+    size_t first = interval.first, last = interval.second;
+
+    if (squared) {
+        vector<double> mean(D, 0.0);
+        for (size_t i = first; i <= last; i++) {
+            for (size_t dim = 0; dim < D; dim++) mean[dim] += getCoordinate(i, dim);
+        }
+        for (size_t dim = 0; dim < D; dim++) mean[dim] /= static_cast<double>(last - first + 1);
+
+        double nearest = std::numeric_limits<double>::max();
+        size_t best = current;
+        for (size_t i = first; i <= last; i++) {
+            double dist = 0.0;
+            for (size_t dim = 0; dim < D; dim++) {
+                double diff = getCoordinate(i, dim) - mean[dim];
+                dist += diff * diff;
+            }
+            if (dist < nearest) {
+                nearest = dist;
+                best = i;
+            }
+        }
+        cost = intervalCost(interval, best);
+        return best;
+    }
+
+    // Candidats : représentants des groupes entièrement dans le cluster, et le centre courant
+    vector<size_t> candidates;
+    size_t g = static_cast<size_t>(std::upper_bound(groupStart.begin(), groupStart.end(), first) - groupStart.begin()) - 1;
+    for (; g + 1 < groupStart.size() && groupStart[g] <= last; g++) {
+        if (representative[g] >= first && representative[g] <= last) candidates.push_back(representative[g]);
+    }
+    candidates.push_back(current);
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    size_t position = static_cast<size_t>(std::lower_bound(candidates.begin(), candidates.end(), current) - candidates.begin());
+    cost = intervalCost(interval, candidates[position]);
+    while (true) {
+        double left = position > 0 ? intervalCost(interval, candidates[position - 1]) : std::numeric_limits<double>::max();
+        double right = position + 1 < candidates.size() ? intervalCost(interval, candidates[position + 1])
+                                                        : std::numeric_limits<double>::max();
+        if (left < cost && left <= right) {
+            cost = left;
+            position--;
+        } else if (right < cost) {
+            cost = right;
+            position++;
+        } else {
+            break;
+        }
+    }
+    return candidates[position];
+}
+
+double CoresetDP::intervalCost(const pair<uint, uint>& interval, size_t center) const {
+    const double* c = &points[center * D];
+    double cost = 0.0;
+    for (size_t i = interval.first; i <= interval.second; i++) {
+        cost += pointDistance(i, c);
+    }
+    return cost;
+}
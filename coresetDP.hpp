@@ -0,0 +1,98 @@
+#pragma once
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include "matrixDouble.hpp"
+#include "solverInterval.hpp"
+
+// Résultat d'un solve approché : coût atteint sur toutes les données et borne inférieure certifiée
+struct CoresetReport {
+    size_t coresetSize;      // Nombre de groupes de points consécutifs
+    double coresetError;     // Somme des dispersions des groupes (erreur de la DP sur le coreset)
+    double coresetCost;      // Coût de la DP sur le coreset (frontières alignées sur les groupes)
+    double cost;             // Coût de la solution rendue, calculé sur tous les points
+    double lowerBound;       // Borne inférieure du coût optimal par intervalles
+    double ratio;            // cost / lowerBound
+    bool errorWithinEpsilon; // coresetError <= epsilon * cost
+    unsigned int rounds;     // Coresets construits (la taille double à chaque tour)
+    double seconds;
+};
+
+/**
+ * Solveur approché pour les très grands fronts. Les points triés sont regroupés
+ * en groupes consécutifs de dispersion bornée (coreset pondéré), la DP par
+ * intervalles est résolue sur les groupes avec des coûts d'intervalle calculés
+ * en O(D + log M) à partir de sommes préfixes, puis les frontières sont affinées
+ * localement et les centres recalculés sur toutes les données. Une seconde DP
+ * sur les groupes donne une borne inférieure du coût optimal.
+ */
+class CoresetDP : public SolverInterval {
+public:
+    // squaredDistance : k-medoids (distance carrée), sinon p-median (distance)
+    explicit CoresetDP(bool squaredDistance = true)
+            : squared(squaredDistance), epsilon(0.01), initialCoresetSize(1024), maxCoresetSize(8192),
+              refinePasses(2), report{0, 0.0, 0.0, 0.0, 0.0, 0.0, false, 0, 0.0}, secondDirection(0.0) {}
+
+    void solve() override;
+
+    // Erreur relative admise pour le coreset ; sa taille part de initialSize et double
+    // (jusqu'à maxSize) tant que la dispersion des groupes dépasse epsilon * coût
+    void setEpsilon(double eps) { epsilon = eps; }
+    void setCoresetSize(size_t initialSize, size_t maxSize);
+    void setRefinePasses(unsigned int passes) { refinePasses = passes; }
+
+    const CoresetReport& getReport() const { return report; }
+    double getLowerBound() const { return report.lowerBound; }
+    double getApproximationRatio() const { return report.ratio; }
+
+    // Indice (ordre trié) du médoïde, ou de la médiane, de chaque intervalle
+    const vector<size_t>& getIntervalCenters() const { return intervalCenters; }
+
+private:
+    bool squared;
+    double epsilon;
+    size_t initialCoresetSize;
+    size_t maxCoresetSize;
+    unsigned int refinePasses;
+    CoresetReport report;
+    vector<size_t> intervalCenters;
+
+    // Groupes : points [groupStart[g], groupStart[g+1]), représentant = point le plus proche du centroïde
+    vector<size_t> groupStart;
+    vector<size_t> representative;
+    vector<double> groupCentroids;  // M x D
+    vector<double> groupSpread;     // Dispersion de chaque groupe
+    // Sommes préfixes aux frontières des groupes : coordonnées ((M+1) x D) et normes carrées
+    vector<double> prefixSums;
+    vector<double> prefixSquares;
+    // Abscisse curviligne de chaque centroïde et sommes préfixes de taille x abscisse (p-median)
+    vector<double> arcLength;
+    vector<double> prefixArc;
+    // Sommes préfixes de la première coordonnée (et de sa valeur absolue) sur tous les points
+    vector<double> prefixFirst;
+    vector<double> prefixAbsFirst;
+    // Idem pour la seconde coordonnée (signée pour être croissante) si elle est monotone, 0 sinon
+    double secondDirection;
+    vector<double> prefixSecond;
+    vector<double> prefixAbsSecond;
+
+    double pointDistance(size_t i, const double* center) const;
+    double spreadOf(double count, double sse) const;
+
+    size_t countGroups(double threshold, vector<size_t>* starts = nullptr) const;
+    void buildGroups(double threshold);
+    void buildCoreset(size_t targetSize);
+    void computePrefixSums();
+
+    // Coût des groupes [a, b] autour du meilleur représentant (center : indice du point)
+    double groupIntervalCost(size_t a, size_t b, size_t& center) const;
+    double groupIntervalLowerBound(size_t a, size_t b) const;
+
+    double solveCoreset(vector<pair<uint, uint>>& intervals, vector<size_t>& centers) const;
+    double lowerBound() const;
+
+    double refine(vector<pair<uint, uint>>& intervals, vector<size_t>& centers) const;
+    void refineCut(size_t c, vector<pair<uint, uint>>& intervals, const vector<size_t>& centers) const;
+    size_t bestCenter(const pair<uint, uint>& interval, size_t current, double& cost) const;
+    double intervalCost(const pair<uint, uint>& interval, size_t center) const;
+};
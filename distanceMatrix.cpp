@@ -0,0 +1,101 @@
+#include "distanceMatrix.hpp"
+#include <algorithm>
+#include <cmath>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+// Nombre de points par tuile : une tranche de coordonnées et l'accumulateur tiennent en L1
+const size_t TILE_SIZE = 256;
+}
+
+void DistanceMatrix::build(const std::vector<double>& points, size_t numPoints, size_t dim,
+                           bool squared, Precision p, const MemoryPolicy& policy) {
+    clear();
+    if (p == NONE || numPoints < 2) return;
+
+    n = numPoints;
+    precision = p;
+
+    if (p == FLOAT32) {
+        valuesFloat.allocate(packedSize(n), policy);
+        fillTiled(valuesFloat, points, dim, squared);
+    } else {
+        valuesDouble.allocate(packedSize(n), policy);
+        fillTiled(valuesDouble, points, dim, squared);
+    }
+}
+
+void DistanceMatrix::clear() {
+    valuesFloat.release();
+    valuesDouble.release();
+    n = 0;
+    precision = NONE;
+}
+
+/**
+ * Fills the packed upper triangle tile by tile: each (I, J) tile pair reuses
+ * the same slice of transposed coordinates for all rows of tile I, and the
+ * inner loop over the columns of tile J is unit-stride and vectorized
+ *
+ * @param out Packed storage of size N(N-1)/2
+ * @param points Flat point coordinates (N x dim)
+ * @param dim Dimension of the points
+ * @param squared Store squared distances (k-medoids) instead of distances (p-median)
+ */
+template <typename T>
+void DistanceMatrix::fillTiled(PolicyBuffer<T>& out, const std::vector<double>& points, size_t dim, bool squared) {
+    // Transposition en structure de tableaux pour des accès contigus par dimension
+    std::vector<double> coords(dim * n);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t d = 0; d < dim; d++) {
+            coords[d * n + i] = points[i * dim + d];
+        }
+    }
+
+    size_t numTiles = (n + TILE_SIZE - 1) / TILE_SIZE;
+
+#pragma omp parallel
+    {
+        std::vector<double> accBuffer(TILE_SIZE);
+        double* acc = accBuffer.data();
+
+#pragma omp for schedule(dynamic)
+        for (size_t t = 0; t < numTiles * numTiles; t++) {
+            size_t tileI = t / numTiles;
+            size_t tileJ = t % numTiles;
+            if (tileJ < tileI) continue; // Triangle supérieur uniquement
+
+            size_t iBegin = tileI * TILE_SIZE;
+            size_t iEnd = std::min(iBegin + TILE_SIZE, n);
+
+            for (size_t i = iBegin; i < iEnd; i++) {
+                size_t jBegin = std::max(tileJ * TILE_SIZE, i + 1);
+                size_t jEnd = std::min((tileJ + 1) * TILE_SIZE, n);
+                if (jBegin >= jEnd) continue;
+                size_t len = jEnd - jBegin;
+
+                std::fill(acc, acc + len, 0.0);
+                for (size_t d = 0; d < dim; d++) {
+                    const double* c = &coords[d * n + jBegin];
+                    double xi = coords[d * n + i];
+#pragma omp simd
+                    for (size_t j = 0; j < len; j++) {
+                        double diff = c[j] - xi;
+                        acc[j] += diff * diff;
+                    }
+                }
+
+                T* row = &out[rowOffset(i) + (jBegin - i - 1)];
+                if (squared) {
+#pragma omp simd
+                    for (size_t j = 0; j < len; j++) row[j] = static_cast<T>(acc[j]);
+                } else {
+#pragma omp simd
+                    for (size_t j = 0; j < len; j++) row[j] = static_cast<T>(std::sqrt(acc[j]));
+                }
+            }
+        }
+    }
+}
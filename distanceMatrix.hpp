@@ -0,0 +1,72 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include "memoryPolicy.hpp"
+
+/**
+ * Matrice symétrique des distances entre points, stockée en triangle supérieur
+ * compacté (N(N-1)/2 valeurs, diagonale implicite à 0), en float ou en double.
+ * La distance stockée est soit la distance euclidienne carrée (k-medoids),
+ * soit la distance euclidienne (p-median).
+ */
+class DistanceMatrix {
+public:
+    enum Precision { NONE, FLOAT32, FLOAT64 };
+
+    DistanceMatrix() : n(0), precision(NONE) {}
+
+    static size_t packedSize(size_t numPoints) {
+        return numPoints < 2 ? 0 : numPoints * (numPoints - 1) / 2;
+    }
+
+    static size_t bytesFor(size_t numPoints, Precision p) {
+        if (p == FLOAT32) return packedSize(numPoints) * sizeof(float);
+        if (p == FLOAT64) return packedSize(numPoints) * sizeof(double);
+        return 0;
+    }
+
+    static const char* precisionName(Precision p) {
+        return p == FLOAT32 ? "float" : (p == FLOAT64 ? "double" : "aucune");
+    }
+
+    void build(const std::vector<double>& points, size_t numPoints, size_t dim,
+               bool squared, Precision p, const MemoryPolicy& policy = MemoryPolicy());
+    void clear();
+
+    bool isBuilt() const { return precision != NONE; }
+    Precision getPrecision() const { return precision; }
+    size_t getBytes() const { return bytesFor(n, precision); }
+    const AllocationReport& getAllocation() const {
+        return precision == FLOAT32 ? valuesFloat.getReport() : valuesDouble.getReport();
+    }
+
+    inline double get(size_t i, size_t j) const {
+        if (i == j) return 0.0;
+        if (i > j) std::swap(i, j);
+        size_t idx = rowOffset(i) + (j - i - 1);
+        return precision == FLOAT32 ? static_cast<double>(valuesFloat[idx]) : valuesDouble[idx];
+    }
+
+    // Ligne i du triangle supérieur en float : rowFloat(i)[j - i - 1] = distance(i, j) pour j > i
+    const float* rowFloat(size_t i) const { return valuesFloat.data() + rowOffset(i); }
+
+    // Accès direct au stockage float, i < j
+    inline float getFloatUpper(size_t i, size_t j) const {
+        return valuesFloat[rowOffset(i) + (j - i - 1)];
+    }
+
+private:
+    size_t n;
+    Precision precision;
+    PolicyBuffer<float> valuesFloat;
+    PolicyBuffer<double> valuesDouble;
+
+    // Début de la ligne i (colonnes j > i) dans le stockage compacté
+    inline size_t rowOffset(size_t i) const {
+        return i * n - i * (i + 1) / 2;
+    }
+
+    template <typename T>
+    void fillTiled(PolicyBuffer<T>& out, const std::vector<double>& points, size_t dim, bool squared);
+};
@@ -0,0 +1,318 @@
+#include "fasterPAM.hpp"
+#include <iostream>
+#include <limits>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <chrono>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * Seeds K medoids (BUILD or k-means++), then runs eager swap passes over the
+ * candidates in cyclic order until N consecutive candidates bring no
+ * improvement, or maxPasses passes. Labels follow the medoids sorted by first
+ * coordinate, as the interval solvers on a 2D front
+ */
+void FasterPAM::solve() {
+    if (N == 0 || K == 0 || K > N) {
+        std::cerr << "Erreur: impossible de partitionner " << N << " points en " << K << " clusters" << std::endl;
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    stats = PamStats{0.0, 0, 0, 0, 0.0};
+
+    if (distanceBudget >= DistanceMatrix::bytesFor(N, DistanceMatrix::FLOAT64)) {
+        distances.build(points, N, D, squared, DistanceMatrix::FLOAT64);
+        trace() << "Matrice des distances précalculée (" << distances.getBytes() << " octets)" << std::endl;
+    } else {
+        distances.clear();
+    }
+
+    // Le premier pas de BUILD donne directement le médoïde optimal pour K = 1
+    if (seeding == PamSeeding::BUILD || K == 1) seedBuild();
+    else seedKMeansPlusPlus();
+
+    assignAll();
+    stats.seedCost = totalCost();
+    double cost = stats.seedCost;
+
+    if (K > 1) {
+        computeRemovalLoss();
+        vector<char> isMedoid(N, 0);
+        for (size_t m : medoids) isMedoid[m] = 1;
+
+        size_t candidate = 0;
+        size_t sinceSwap = 0;
+        while (sinceSwap < N && stats.passes < maxPasses) {
+            if (!isMedoid[candidate]) {
+                stats.evaluations++;
+                size_t m;
+                double delta = bestSwap(candidate, m);
+                // Tolérance relative : évite de boucler sur des gains d'arrondi
+                if (delta < -1e-12 * std::max(cost, std::numeric_limits<double>::min())) {
+                    isMedoid[medoids[m]] = 0;
+                    isMedoid[candidate] = 1;
+                    applySwap(m, candidate);
+                    cost += delta;
+                    stats.swaps++;
+                    sinceSwap = 0;
+                }
+            }
+            sinceSwap++;
+            candidate++;
+            if (candidate == N) {
+                candidate = 0;
+                stats.passes++;
+            }
+        }
+    }
+
+    // Étiquettes dans l'ordre de la première coordonnée des médoïdes
+    vector<size_t> order(K);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        double xa = points[medoids[a] * D], xb = points[medoids[b] * D];
+        return xa < xb || (xa == xb && medoids[a] < medoids[b]);
+    });
+    vector<size_t> label(K);
+    vector<size_t> sortedMedoids(K);
+    for (size_t r = 0; r < K; r++) {
+        label[order[r]] = r + 1;
+        sortedMedoids[r] = medoids[order[r]];
+    }
+
+    solution.assign(N, 0);
+    for (size_t i = 0; i < N; i++) solution[i] = label[nearest[i]];
+    solutionCost = totalCost();
+    medoids = sortedMedoids;
+    for (size_t i = 0; i < N; i++) nearest[i] = solution[i] - 1;
+
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    trace() << "FasterPAM (" << (squared ? "k-medoids" : "p-median") << "): coût " << solutionCost
+              << " (initialisation " << stats.seedCost << "), " << stats.swaps << " échanges, "
+              << stats.evaluations << " candidats évalués, " << stats.seconds << " s" << std::endl;
+}
+
+/**
+ * BUILD seeding of PAM: the first medoid minimizes the total distance, each
+ * next one maximizes the decrease of the cost. O(K N^2), parallel over the
+ * candidates; ties go to the smallest index
+ */
+void FasterPAM::seedBuild() {
+    medoids.clear();
+    nearestDistance.assign(N, std::numeric_limits<double>::infinity());
+    vector<char> isMedoid(N, 0);
+    bool useParallel = (N > 256);
+
+    for (size_t k = 0; k < K; k++) {
+        double bestGain = -std::numeric_limits<double>::infinity();
+        size_t best = N;
+
+#pragma omp parallel if(useParallel)
+        {
+            double localGain = -std::numeric_limits<double>::infinity();
+            size_t localBest = N;
+
+#pragma omp for schedule(dynamic, 16)
+            for (size_t j = 0; j < N; j++) {
+                if (isMedoid[j]) continue;
+                double gain = 0.0;
+                for (size_t i = 0; i < N; i++) {
+                    double dij = dissimilarity(i, j);
+                    // Premier médoïde : gain = -coût total
+                    gain += (k == 0) ? -dij : std::max(0.0, nearestDistance[i] - dij);
+                }
+                if (gain > localGain) {
+                    localGain = gain;
+                    localBest = j;
+                }
+            }
+
+#pragma omp critical(pamBuild)
+            if (localGain > bestGain || (localGain == bestGain && localBest < best)) {
+                bestGain = localGain;
+                best = localBest;
+            }
+        }
+
+        medoids.push_back(best);
+        isMedoid[best] = 1;
+        for (size_t i = 0; i < N; i++) {
+            nearestDistance[i] = std::min(nearestDistance[i], dissimilarity(i, best));
+        }
+    }
+}
+
+/**
+ * k-means++ seeding: the first medoid is drawn uniformly, each next one with a
+ * probability proportional to the squared distance to its nearest medoid.
+ * O(K N), reproducible with setSeed()
+ */
+void FasterPAM::seedKMeansPlusPlus() {
+    std::mt19937_64 rng(seed);
+    medoids.clear();
+    nearestDistance.assign(N, std::numeric_limits<double>::infinity());
+    vector<char> isMedoid(N, 0);
+
+    size_t next = std::uniform_int_distribution<size_t>(0, N - 1)(rng);
+    for (size_t k = 0; k < K; k++) {
+        medoids.push_back(next);
+        isMedoid[next] = 1;
+        if (k + 1 == K) break;
+
+        double total = 0.0;
+        for (size_t i = 0; i < N; i++) {
+            nearestDistance[i] = std::min(nearestDistance[i], dissimilarity(i, next));
+            total += squared ? nearestDistance[i] : nearestDistance[i] * nearestDistance[i];
+        }
+
+        // Tous les points restants confondus avec un médoïde : premier point libre
+        next = N;
+        if (total > 0.0) {
+            double target = std::uniform_real_distribution<double>(0.0, total)(rng);
+            for (size_t i = 0; i < N; i++) {
+                double weight = squared ? nearestDistance[i] : nearestDistance[i] * nearestDistance[i];
+                if (weight <= 0.0 || isMedoid[i]) continue;
+                next = i;
+                target -= weight;
+                if (target < 0.0) break;
+            }
+        }
+        for (size_t i = 0; next == N && i < N; i++) {
+            if (!isMedoid[i]) next = i;
+        }
+    }
+}
+
+/**
+ * Recomputes the nearest and second nearest medoids of point i, O(K D)
+ */
+void FasterPAM::updateAssignment(size_t i) {
+    size_t n1 = 0, n2 = 0;
+    double d1 = std::numeric_limits<double>::infinity();
+    double d2 = std::numeric_limits<double>::infinity();
+    for (size_t m = 0; m < K; m++) {
+        double d = dissimilarity(i, medoids[m]);
+        if (d < d1) {
+            n2 = n1;
+            d2 = d1;
+            n1 = m;
+            d1 = d;
+        } else if (d < d2) {
+            n2 = m;
+            d2 = d;
+        }
+    }
+    nearest[i] = n1;
+    nearestDistance[i] = d1;
+    second[i] = n2;
+    secondDistance[i] = d2;
+}
+
+void FasterPAM::assignAll() {
+    nearest.assign(N, 0);
+    second.assign(N, 0);
+    nearestDistance.assign(N, 0.0);
+    secondDistance.assign(N, 0.0);
+    bool useParallel = (N > 4096);
+
+#pragma omp parallel for if(useParallel) schedule(static)
+    for (size_t i = 0; i < N; i++) {
+        updateAssignment(i);
+    }
+}
+
+/**
+ * Loss of removing medoid m alone: every point attached to m moves to its
+ * second nearest medoid
+ */
+void FasterPAM::computeRemovalLoss() {
+    removalLoss.assign(K, 0.0);
+    for (size_t i = 0; i < N; i++) {
+        removalLoss[nearest[i]] += secondDistance[i] - nearestDistance[i];
+    }
+}
+
+double FasterPAM::totalCost() const {
+    double cost = 0.0;
+    for (size_t i = 0; i < N; i++) cost += nearestDistance[i];
+    return cost;
+}
+
+/**
+ * Evaluates the K swaps (medoid m, candidate) in one pass over the points
+ * (FasterPAM): delta[m] starts at the removal loss of m; a point closer to the
+ * candidate than to its nearest medoid moves to the candidate whatever m is
+ * (shared term) and cancels its share of the removal loss; a point
+ * closer to the candidate than to its second nearest only changes the loss of
+ * removing its nearest medoid. The points are split across threads, each with
+ * its own delta array
+ *
+ * @param candidate Index of a point that is not a medoid
+ * @param m Output: position of the medoid to replace
+ * @return Cost change of the best swap (negative when it improves)
+ */
+double FasterPAM::bestSwap(size_t candidate, size_t& m) const {
+    vector<double> delta(removalLoss);
+    double shared = 0.0;
+    bool useParallel = (N > 4096);
+
+#pragma omp parallel if(useParallel)
+    {
+        vector<double> localDelta(K, 0.0);
+        double localShared = 0.0;
+
+#pragma omp for schedule(static) nowait
+        for (size_t i = 0; i < N; i++) {
+            double dc = dissimilarity(i, candidate);
+            if (dc < nearestDistance[i]) {
+                localShared += dc - nearestDistance[i];
+                localDelta[nearest[i]] += nearestDistance[i] - secondDistance[i];
+            } else if (dc < secondDistance[i]) {
+                localDelta[nearest[i]] += dc - secondDistance[i];
+            }
+        }
+
+#pragma omp critical(pamSwapGain)
+        {
+            shared += localShared;
+            for (size_t k = 0; k < K; k++) delta[k] += localDelta[k];
+        }
+    }
+
+    m = static_cast<size_t>(std::min_element(delta.begin(), delta.end()) - delta.begin());
+    return delta[m] + shared;
+}
+
+/**
+ * Replaces medoid m by the candidate and updates the caches: only the points
+ * whose nearest or second nearest medoid was m are rescanned, the others
+ * compare the candidate with their two cached distances
+ */
+void FasterPAM::applySwap(size_t m, size_t candidate) {
+    medoids[m] = candidate;
+    bool useParallel = (N > 4096);
+
+#pragma omp parallel for if(useParallel) schedule(static)
+    for (size_t i = 0; i < N; i++) {
+        if (nearest[i] == m || second[i] == m) {
+            updateAssignment(i);
+            continue;
+        }
+        double dc = dissimilarity(i, candidate);
+        if (dc < nearestDistance[i]) {
+            second[i] = nearest[i];
+            secondDistance[i] = nearestDistance[i];
+            nearest[i] = m;
+            nearestDistance[i] = dc;
+        } else if (dc < secondDistance[i]) {
+            second[i] = m;
+            secondDistance[i] = dc;
+        }
+    }
+
+    computeRemovalLoss();
+}
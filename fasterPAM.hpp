@@ -0,0 +1,89 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include "solver.hpp"
+#include "distanceMatrix.hpp"
+
+// Initialisation des médoïdes avant la phase d'échanges
+enum class PamSeeding {
+    BUILD,           // Glouton de PAM : O(K N^2), meilleure initialisation
+    KMEANS_PLUS_PLUS // Tirage proportionnel à la distance carrée au médoïde le plus proche : O(K N)
+};
+
+struct PamStats {
+    double seedCost;       // Coût après l'initialisation
+    unsigned int passes;   // Passes sur les candidats
+    size_t swaps;          // Échanges effectués
+    size_t evaluations;    // Candidats évalués
+    double seconds;
+};
+
+/**
+ * K-medoids général (sans ordre des points) par échanges gloutons à la FasterPAM :
+ * pour chaque candidat, le gain de tous les échanges (médoïde m, candidat) est
+ * évalué en un seul passage sur les points grâce au médoïde le plus proche et au
+ * second plus proche de chaque point, gardés en cache ; l'échange est appliqué dès
+ * qu'il améliore le coût (échanges immédiats), jusqu'à une passe complète sans
+ * amélioration. Valable en toute dimension : les points restent dans l'ordre du
+ * fichier et la solution s'exporte comme celle des autres solveurs.
+ */
+class FasterPAM : public Solver {
+public:
+    // squaredDistance : k-medoids (distance carrée), sinon p-median (distance)
+    explicit FasterPAM(bool squaredDistance = true)
+            : squared(squaredDistance), seeding(PamSeeding::KMEANS_PLUS_PLUS), seed(42), maxPasses(100),
+              distanceBudget(0), stats{0.0, 0, 0, 0, 0.0} {}
+
+    void solve() override;
+
+    void setSeeding(PamSeeding method) { seeding = method; }
+    void setSeed(uint64_t value) { seed = value; }
+    void setMaxPasses(unsigned int passes) { maxPasses = passes; }
+    // Précalcul des distances (en double) si N(N-1)/2 valeurs tiennent dans le budget
+    void setDistanceMatrixBudget(size_t bytes) { distanceBudget = bytes; }
+
+    const PamStats& getStats() const { return stats; }
+    // Indice (ordre du fichier) du médoïde de chaque cluster, étiquette = position + 1
+    const vector<size_t>& getMedoids() const { return medoids; }
+
+private:
+    bool squared;
+    PamSeeding seeding;
+    uint64_t seed;
+    unsigned int maxPasses;
+    size_t distanceBudget;
+    PamStats stats;
+    DistanceMatrix distances;
+
+    vector<size_t> medoids;
+    // Cache par point : médoïde le plus proche, second plus proche (positions dans medoids) et distances
+    vector<size_t> nearest;
+    vector<size_t> second;
+    vector<double> nearestDistance;
+    vector<double> secondDistance;
+    // Perte à la suppression de chaque médoïde (points rattachés au second plus proche)
+    vector<double> removalLoss;
+
+    inline double dissimilarity(size_t i, size_t j) const {
+        if (distances.isBuilt()) return distances.get(i, j);
+        const double* a = &points[i * D];
+        const double* b = &points[j * D];
+        double result = 0.0;
+        for (size_t d = 0; d < D; d++) {
+            double diff = a[d] - b[d];
+            result += diff * diff;
+        }
+        return squared ? result : std::sqrt(result);
+    }
+
+    void seedBuild();
+    void seedKMeansPlusPlus();
+    void assignAll();
+    void updateAssignment(size_t i);
+    void computeRemovalLoss();
+    double totalCost() const;
+
+    // Meilleur échange pour le candidat : renvoie la variation du coût, m = médoïde à remplacer
+    double bestSwap(size_t candidate, size_t& m) const;
+    void applySwap(size_t m, size_t candidate);
+};
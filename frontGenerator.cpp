@@ -0,0 +1,191 @@
+#include "frontGenerator.hpp"
+#include "solver.hpp"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+// Points produits et écrits par morceau (1 Mi points)
+const size_t CHUNK_POINTS = size_t(1) << 20;
+
+// Flux de tirages d'un point : doublon, source du doublon, décalage, bruit (2 par objectif), angles
+const uint64_t STREAM_DUPLICATE = 0;
+const uint64_t STREAM_SOURCE = 1;
+const uint64_t STREAM_DOMINATED = 2;
+const uint64_t STREAM_NOISE = 3;
+const uint64_t STREAM_ANGLE = 1 << 16;
+
+inline uint64_t splitmix64(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+}
+
+FrontGenerator::FrontGenerator(const FrontOptions& opts) : options(opts) {
+    if (options.D < 2) throw std::invalid_argument("un front a au moins 2 objectifs");
+    if (options.segments == 0) options.segments = 1;
+}
+
+double FrontGenerator::uniform(size_t i, uint64_t stream) const {
+    uint64_t h = splitmix64(splitmix64(options.seed ^ (stream * 0xD1B54A32D192ED03ULL)) + i);
+    return static_cast<double>(h >> 11) / 9007199254740992.0;  // 2^53
+}
+
+void FrontGenerator::basePoint(size_t i, double* out) const {
+    const size_t D = options.D;
+    const double halfPi = 0.5 * M_PI;
+
+    // DTLZ2 : f_0 = prod cos(θ_j), f_m = prod_{j < D-1-m} cos(θ_j) * sin(θ_{D-1-m})
+    double first = uniform(i, STREAM_ANGLE);
+    if (options.shape == FrontShape::DISCONNECTED) {
+        // Bandes paires parmi 2G-1 bandes égales du premier angle
+        double G = static_cast<double>(options.segments);
+        double band = std::min(std::floor(first * G), G - 1.0);
+        first = (2.0 * band + (first * G - band)) / (2.0 * G - 1.0);
+    }
+
+    double product = 1.0;
+    for (size_t j = 0; j + 1 < D; j++) {
+        double angle = halfPi * (j == 0 ? first : uniform(i, STREAM_ANGLE + j));
+        out[D - 1 - j] = product * std::sin(angle);
+        product *= std::cos(angle);
+    }
+    out[0] = product;
+
+    if (options.shape == FrontShape::CONVEX) {
+        for (size_t d = 0; d < D; d++) out[d] = 1.0 - out[d];
+    }
+
+    // Décalage vers le haut sur chaque objectif : le point est dominé par le point du front
+    if (options.dominatedFraction > 0.0 && uniform(i, STREAM_DOMINATED) < options.dominatedFraction) {
+        for (size_t d = 0; d < D; d++) {
+            double u1 = 1.0 - uniform(i, STREAM_NOISE + 2 * d);
+            double u2 = uniform(i, STREAM_NOISE + 2 * d + 1);
+            out[d] += options.noise * std::fabs(std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * M_PI * u2));
+        }
+    }
+
+    for (size_t d = 0; d < D; d++) out[d] *= options.scale;
+}
+
+/**
+ * A duplicate copies the final point of its source, so the chain of sources
+ * is followed down to the first index that is not itself a duplicate; every
+ * step moves to a lower index, so the chain ends and depends only on (seed, i)
+ */
+void FrontGenerator::point(size_t i, double* out) const {
+    size_t source = i;
+    while (source > 0 && options.duplicateFraction > 0.0
+           && uniform(source, STREAM_DUPLICATE) < options.duplicateFraction) {
+        source = std::min(source - 1, static_cast<size_t>(uniform(source, STREAM_SOURCE) * static_cast<double>(source)));
+    }
+    basePoint(source, out);
+}
+
+void FrontGenerator::generate(size_t first, size_t count, double* out) const {
+    const size_t D = options.D;
+#pragma omp parallel for if(count > 10000) schedule(static)
+    for (size_t p = 0; p < count; p++) {
+        point(first + p, out + p * D);
+    }
+}
+
+std::vector<double> FrontGenerator::generate() const {
+    std::vector<double> points(options.N * options.D);
+    generate(0, options.N, points.data());
+    return points;
+}
+
+/**
+ * Writes the front chunk by chunk: each chunk is generated, formatted in
+ * parallel slices and written in order, so memory stays bounded for 10^8
+ * points
+ */
+bool FrontGenerator::writeText(const std::string& filename, int digits) const {
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Erreur: impossible de créer " << filename << std::endl;
+        return false;
+    }
+    file << options.N << " " << options.D << "\n";
+
+    const size_t D = options.D;
+    const size_t slices = 64;
+    std::vector<double> chunk(std::min(options.N, CHUNK_POINTS) * D);
+    std::vector<std::string> text(slices);
+
+    for (size_t first = 0; first < options.N; first += CHUNK_POINTS) {
+        size_t count = std::min(CHUNK_POINTS, options.N - first);
+        generate(first, count, chunk.data());
+
+#pragma omp parallel for if(count > 10000) schedule(dynamic)
+        for (size_t s = 0; s < slices; s++) {
+            size_t begin = count * s / slices, end = count * (s + 1) / slices;
+            std::string& out = text[s];
+            out.clear();
+            char buffer[64];
+            for (size_t p = begin; p < end; p++) {
+                for (size_t d = 0; d < D; d++) {
+                    int length = std::snprintf(buffer, sizeof(buffer), "%.*f", digits, chunk[p * D + d]);
+                    out.append(buffer, static_cast<size_t>(length));
+                    out.push_back(d + 1 < D ? ' ' : '\n');
+                }
+            }
+        }
+
+        for (const std::string& slice : text) file.write(slice.data(), static_cast<std::streamsize>(slice.size()));
+    }
+
+    if (!file) {
+        std::cerr << "Erreur: écriture de " << filename << " incomplète" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool FrontGenerator::writeBinary(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Erreur: impossible de créer " << filename << std::endl;
+        return false;
+    }
+    uint64_t header[2] = {options.N, options.D};
+    file.write(POINTS_BINARY_MAGIC, sizeof(POINTS_BINARY_MAGIC) - 1);
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+    std::vector<double> chunk(std::min(options.N, CHUNK_POINTS) * options.D);
+    for (size_t first = 0; first < options.N; first += CHUNK_POINTS) {
+        size_t count = std::min(CHUNK_POINTS, options.N - first);
+        generate(first, count, chunk.data());
+        file.write(reinterpret_cast<const char*>(chunk.data()), static_cast<std::streamsize>(count * options.D * sizeof(double)));
+    }
+
+    if (!file) {
+        std::cerr << "Erreur: écriture de " << filename << " incomplète" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool FrontGenerator::parseShape(const std::string& name, FrontShape& shape) {
+    if (name == "convex") shape = FrontShape::CONVEX;
+    else if (name == "concave") shape = FrontShape::CONCAVE;
+    else if (name == "disconnected") shape = FrontShape::DISCONNECTED;
+    else return false;
+    return true;
+}
+
+std::string FrontGenerator::shapeName(FrontShape shape) {
+    switch (shape) {
+        case FrontShape::CONVEX: return "convex";
+        case FrontShape::CONCAVE: return "concave";
+        default: return "disconnected";
+    }
+}
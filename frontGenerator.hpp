@@ -0,0 +1,61 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+enum class FrontShape { CONVEX, CONCAVE, DISCONNECTED };
+
+struct FrontOptions {
+    size_t N;                  // Nombre de points
+    size_t D;                  // Nombre d'objectifs (>= 2)
+    FrontShape shape;
+    size_t segments;           // Morceaux du front DISCONNECTED
+    uint64_t seed;
+    double dominatedFraction;  // Part des points décalés derrière le front
+    double noise;              // Amplitude du décalage, relative à scale
+    double duplicateFraction;  // Part des points copiés d'un point d'indice inférieur
+    double scale;              // Les objectifs sont dans [0, scale]
+
+    FrontOptions() : N(1000), D(2), shape(FrontShape::CONVEX), segments(4), seed(1), dominatedFraction(0.0),
+                     noise(0.05), duplicateFraction(0.0), scale(1000.0) {}
+};
+
+/**
+ * Générateur de fronts de Pareto synthétiques (minimisation de D objectifs). Le point i
+ * est une fonction pure de (seed, i) : un hachage à compteur remplace le générateur
+ * séquentiel, si bien que les points sont produits en parallèle, par morceaux, et que
+ * le résultat ne dépend ni du nombre de threads ni du découpage.
+ *
+ * Le front est paramétré comme DTLZ2 (angles uniformes, point f sur la sphère unité
+ * positive) : CONCAVE rend f, CONVEX rend 1 - f, DISCONNECTED garde f sur `segments`
+ * bandes du premier angle séparées par des trous. Un point dominé est le point du front
+ * décalé vers le haut sur chaque objectif ; un doublon recopie exactement un point
+ * d'indice inférieur. Les points sortent dans l'ordre des indices (non triés).
+ */
+class FrontGenerator {
+public:
+    explicit FrontGenerator(const FrontOptions& options);
+
+    // Coordonnées du point i dans out[0..D-1]
+    void point(size_t i, double* out) const;
+    // Points first..first+count-1 à plat dans out (en parallèle)
+    void generate(size_t first, size_t count, double* out) const;
+    std::vector<double> generate() const;
+
+    // Format texte des instances ("N D" puis un point par ligne, digits décimales)
+    bool writeText(const std::string& filename, int digits = 6) const;
+    // Format binaire lu par Solver::import (en-tête POINTS_BINARY_MAGIC, N, D, puis les doubles)
+    bool writeBinary(const std::string& filename) const;
+
+    static bool parseShape(const std::string& name, FrontShape& shape);
+    static std::string shapeName(FrontShape shape);
+
+private:
+    FrontOptions options;
+
+    // Réel uniforme dans [0, 1[ tiré de (seed, i, stream)
+    double uniform(size_t i, uint64_t stream) const;
+    // Point du front (éventuellement dominé) avant la recopie des doublons
+    void basePoint(size_t i, double* out) const;
+};
@@ -0,0 +1,277 @@
+#include "fusedDP.hpp"
+#include <limits>
+#include <iostream>
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * Solves both criteria on all the points. The point reduction of SolverDP is
+ * rejected (no solution): expanding it reorders the points by the labels of
+ * one solution, which would break the intervals of the other. So are the
+ * inherited options that the joint sweep does not apply (see
+ * unsupportedOption); the length bounds, the distance matrix budget and the
+ * memory policy are honored
+ */
+void FusedDP::solve() {
+    if (!validateInputs()) return;
+
+    reductionStats = ReductionStats{N, 0, 0, N};
+    if (removeDominated || collapseDuplicates) {
+        std::cerr << "Erreur: FusedDP ne prend pas en charge la réduction des points (les deux partitions "
+                  << "portent sur tous les points)" << std::endl;
+        clearSolutions();
+        return;
+    }
+    string option = unsupportedOption();
+    if (!option.empty()) {
+        std::cerr << "Erreur: FusedDP ne prend pas en charge " << option << std::endl;
+        clearSolutions();
+        return;
+    }
+
+    resort(); // Trier les points
+    prepareDistanceMatrix(); // Distances carrées, la racine est prise à la lecture
+    initializeMatrix();
+    matrixMedian = matrixDP;
+
+    fillBothMatrices();
+
+    backtrack(matrixDP, false, solutionInterval);
+    backtrack(matrixMedian, true, medianInterval);
+
+    computeSolutionFromIntervals();
+    medianSolution.assign(N, 0);
+    computeSolutionFromIntervals(medianInterval, medianSolution);
+
+    calculateFinalCost();
+    medianSolutionCost = matrixMedian.getElement(K-1, N-1);
+
+    evaluateCrossCosts();
+}
+
+// Option de SolverDP réglée mais que le balayage conjoint n'applique pas (vide : aucune)
+string FusedDP::unsupportedOption() const {
+    if (mixedPrecision) return "la précision mixte";
+    if (memoryBudget > 0) return "le budget mémoire (mode hors mémoire)";
+    if (warmStart) return "le démarrage à chaud";
+    if (tiledFill || wavefrontFill) return "le remplissage par tuiles ou en pipeline";
+    if (costCacheEntries > 0) return "le cache des coûts d'intervalle";
+    if (!checkpointPath.empty() || !resumePath.empty()) return "les points de reprise";
+    return "";
+}
+
+// Solve refusé : aucune des deux solutions n'est rendue (pas même celles d'un solve précédent)
+void FusedDP::clearSolutions() {
+    solutionInterval.clear();
+    medianInterval.clear();
+    solution.assign(N, 0);
+    medianSolution.assign(N, 0);
+    solutionCost = std::numeric_limits<double>::max();
+    medianSolutionCost = std::numeric_limits<double>::max();
+}
+
+/**
+ * Fills both DP tables in a single sweep: each cost vector computed for column n
+ * feeds the k-medoids table and the p-median table before being discarded
+ */
+void FusedDP::fillBothMatrices() {
+    // Première ligne : un seul cluster [0, n], dans la limite des tailles admissibles
+    uint L = getMaxClusterLength();
+    bool useParallel = (N > 100);
+
+#pragma omp parallel for if(useParallel) schedule(dynamic)
+    for (uint n = minClusterLength - 1; n < L; n++) {
+        double medoidsCost, medianCost;
+        calculateClusterCosts(0, n, medoidsCost, medianCost);
+        matrixDP.setElement(0, n, medoidsCost);
+        matrixMedian.setElement(0, n, medianCost);
+    }
+
+    for (uint k = 1; k < K && k < matrixDP.getRows(); k++) {
+        useParallel = (N > 50);
+
+#pragma omp parallel if(useParallel)
+        {
+            vector<double> local_vMedoids(L, 0.0);
+            vector<double> local_vMedian(L, 0.0);
+
+#pragma omp for schedule(dynamic)
+            for (uint n = k; n < N; n++) {
+                clusterCostsBoth(n, local_vMedoids, local_vMedian);
+                std::reverse(local_vMedoids.begin(), local_vMedoids.end()); // Rangement par split
+                std::reverse(local_vMedian.begin(), local_vMedian.end());
+
+                OptimalSplit splitMedoids = findOptimalSplit(matrixDP, k, n, local_vMedoids);
+                OptimalSplit splitMedian = findOptimalSplit(matrixMedian, k, n, local_vMedian);
+
+                matrixDP.setElement(k, n, splitMedoids.cost);
+                matrixMedian.setElement(k, n, splitMedian.cost);
+            }
+        }
+    }
+}
+
+void FusedDP::backtrack(const MatrixDouble& dp, bool useMedian, vector<pair<uint, uint>>& intervals) {
+    intervals.clear();
+
+    uint currentK = K - 1;
+    uint currentN = N - 1;
+    vector<double> vMedoids(getMaxClusterLength(), 0.0);
+    vector<double> vMedian(getMaxClusterLength(), 0.0);
+
+    while (currentK > 0) {
+        clusterCostsBoth(currentN, vMedoids, vMedian);
+        std::reverse(vMedoids.begin(), vMedoids.end()); // Rangement par split
+        std::reverse(vMedian.begin(), vMedian.end());
+        OptimalSplit optSplit = findOptimalSplit(dp, currentK, currentN, useMedian ? vMedian : vMedoids);
+
+        if (optSplit.isValid) {
+            intervals.push_back(make_pair(optSplit.splitPoint + 1, currentN));
+            currentN = optSplit.splitPoint;
+            currentK--;
+        } else {
+            break;
+        }
+    }
+
+    if (currentK == 0) {
+        intervals.push_back(make_pair(0, currentN));
+    }
+
+    reverse(intervals.begin(), intervals.end());
+}
+
+/**
+ * Evaluates each solution on both criteria. Intervals are consecutive in the
+ * sorted order, so one fused pass per interval yields both costs
+ */
+void FusedDP::evaluateCrossCosts() {
+    crossCosts = {0.0, 0.0, 0.0, 0.0};
+
+    for (const auto& interval : solutionInterval) {
+        double medoidsCost, medianCost;
+        calculateClusterCosts(interval.first, interval.second, medoidsCost, medianCost);
+        crossCosts.medoidsOnMedoids += medoidsCost;
+        crossCosts.medoidsOnMedian += medianCost;
+    }
+
+    for (const auto& interval : medianInterval) {
+        double medoidsCost, medianCost;
+        calculateClusterCosts(interval.first, interval.second, medoidsCost, medianCost);
+        crossCosts.medianOnMedoids += medoidsCost;
+        crossCosts.medianOnMedian += medianCost;
+    }
+}
+
+/**
+ * Computes k-medoids cluster costs for all possible clusters ending at index i
+ * Only used through the SolverDP interface; the fused sweep calls clusterCostsBoth
+ *
+ * @param i The ending index for all clusters to compute
+ * @param v Output vector where v[j] = cost of cluster with j+1 points ending at i
+ */
+void FusedDP::clusterCostsBefore(uint i, vector<double>& v) {
+    vector<double> vMedian(v.size(), 0.0);
+    clusterCostsBoth(i, v, vMedian);
+}
+
+/**
+ * Computes k-medoids cluster costs for all possible clusters starting from index 0
+ *
+ * @param v Output vector where v[j] = cost of cluster with first j+1 points
+ */
+void FusedDP::clusterCostsFromBeginning(vector<double>& v) {
+    std::fill(v.begin(), v.end(), std::numeric_limits<double>::max());
+
+    uint maxPoints = std::min(static_cast<uint>(N), static_cast<uint>(v.size()));
+    double medianCost;
+
+    for (uint numPoints = 1; numPoints <= maxPoints; numPoints++) {
+        if (fillInterrupted()) break;
+        calculateClusterCosts(0, numPoints - 1, v[numPoints - 1], medianCost);
+    }
+}
+
+/**
+ * Calculates the k-medoids cost of a cluster of consecutive points
+ *
+ * @param start Starting index of the cluster (inclusive)
+ * @param end Ending index of the cluster (inclusive)
+ * @return Minimum sum of squared distances to a medoid
+ */
+double FusedDP::calculateClusterCost(uint start, uint end) const {
+    double medoidsCost, medianCost;
+    calculateClusterCosts(start, end, medoidsCost, medianCost);
+    return medoidsCost;
+}
+
+/**
+ * Computes both cluster costs for all possible clusters ending at index i
+ *
+ * @param i The ending index for all clusters to compute
+ * @param vMedoids Output vector where vMedoids[j] = k-medoids cost of cluster with j+1 points ending at i
+ * @param vMedian Output vector where vMedian[j] = p-median cost of cluster with j+1 points ending at i
+ */
+void FusedDP::clusterCostsBoth(uint i, vector<double>& vMedoids, vector<double>& vMedian) {
+    std::fill(vMedoids.begin(), vMedoids.end(), std::numeric_limits<double>::max());
+    std::fill(vMedian.begin(), vMedian.end(), std::numeric_limits<double>::max());
+
+    if (vMedoids.size() == 0 || i >= N) return;
+
+    bool useParallel = (i > 50);
+
+    uint maxPoints = std::min(static_cast<uint>(i + 1),
+                              static_cast<uint>(std::min(vMedoids.size(), vMedian.size())));
+
+#pragma omp parallel for if(useParallel) schedule(dynamic)
+    for (uint numPoints = 1; numPoints <= maxPoints; numPoints++) {
+        if (fillInterrupted()) continue;
+        uint clusterStart = i - numPoints + 1;
+        calculateClusterCosts(clusterStart, i, vMedoids[numPoints - 1], vMedian[numPoints - 1]);
+    }
+}
+
+/**
+ * Calculates the optimal k-medoids and p-median costs of a cluster of consecutive
+ * points in a single pass: each squared distance is computed once and feeds both
+ * sums (squared for k-medoids, square-rooted for p-median)
+ *
+ * @param start Starting index of the cluster (inclusive)
+ * @param end Ending index of the cluster (inclusive)
+ * @param medoidsCost Output: minimum sum of squared distances to a medoid
+ * @param medianCost Output: minimum sum of distances to a median
+ */
+void FusedDP::calculateClusterCosts(uint start, uint end, double& medoidsCost, double& medianCost) const {
+    medoidsCost = 0.0;
+    medianCost = 0.0;
+    if (start >= end) return;
+
+    double minMedoids = std::numeric_limits<double>::max();
+    double minMedian = std::numeric_limits<double>::max();
+    uint clusterSize = end - start + 1;
+
+    bool useParallel = (clusterSize > 20);
+
+#pragma omp parallel for if(useParallel) reduction(min:minMedoids, minMedian) schedule(dynamic)
+    for (uint center = start; center <= end; center++) {
+        double costMedoids = 0.0;
+        double costMedian = 0.0;
+
+        for (uint i = start; i <= end; i++) {
+            if (i != center) {
+                double dist = d.isBuilt() ? d.get(i, center) : squaredDistance(i, center);
+                double weight = pointWeight(i);
+                costMedoids += weight * dist;
+                costMedian += weight * sqrt(dist);
+            }
+        }
+
+        if (costMedoids < minMedoids) minMedoids = costMedoids;
+        if (costMedian < minMedian) minMedian = costMedian;
+    }
+
+    medoidsCost = minMedoids;
+    medianCost = minMedian;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include "solverDP.hpp"
+
+/**
+ * Résolution conjointe k-medoids / p-median sur une même instance.
+ * Les deux coûts d'intervalle sont calculés dans une seule passe sur les distances
+ * et les deux matrices DP sont remplies dans le même balayage.
+ * La solution "principale" (solution, solutionCost) est celle des k-medoids.
+ */
+class FusedDP : public SolverDP {
+public:
+    struct CrossCosts {
+        double medoidsOnMedoids; // Solution médoïdes évaluée sur critère médoïdes
+        double medoidsOnMedian;  // Solution médoïdes évaluée sur critère médian
+        double medianOnMedoids;  // Solution médian évaluée sur critère médoïdes
+        double medianOnMedian;   // Solution médian évaluée sur critère médian
+    };
+
+    FusedDP() : medianSolutionCost(0.0), crossCosts{0.0, 0.0, 0.0, 0.0} {}
+
+    void solve() override;
+
+    const vector<size_t>& getMedoidsSolution() const { return solution; }
+    const vector<size_t>& getMedianSolution() const { return medianSolution; }
+    double getMedianSolutionCost() const { return medianSolutionCost; }
+    const CrossCosts& getCrossCosts() const { return crossCosts; }
+
+protected:
+    // solveWithin, update et solveForClusters ne rempliraient que la table k-medoids : refusés
+    bool supportsGenericFill() const override { return false; }
+
+    void clusterCostsBefore(uint i, vector<double>& v) override;
+    void clusterCostsFromBeginning(vector<double>& v) override;
+    double calculateClusterCost(uint start, uint end) const override;
+
+    void clusterCostsBoth(uint i, vector<double>& vMedoids, vector<double>& vMedian);
+    void calculateClusterCosts(uint start, uint end, double& medoidsCost, double& medianCost) const;
+
+private:
+    MatrixDouble matrixMedian;
+    vector<pair<uint, uint>> medianInterval;
+    vector<size_t> medianSolution;
+    double medianSolutionCost;
+    CrossCosts crossCosts;
+
+    string unsupportedOption() const;
+    void clearSolutions();
+    void fillBothMatrices();
+    void backtrack(const MatrixDouble& dp, bool useMedian, vector<pair<uint, uint>>& intervals);
+    void evaluateCrossCosts();
+};
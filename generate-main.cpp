@@ -0,0 +1,75 @@
+#include "frontGenerator.hpp"
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <exception>
+
+static void usage(const char* program) {
+    std::cerr << "Usage: " << program << " <sortie> [options]" << std::endl
+              << "  -n N               nombre de points (1000)" << std::endl
+              << "  -d D               nombre d'objectifs (2)" << std::endl
+              << "  --shape forme      convex, concave ou disconnected (convex)" << std::endl
+              << "  --segments G       morceaux du front disconnected (4)" << std::endl
+              << "  --seed s           graine (1)" << std::endl
+              << "  --dominated f      part des points dominés (0)" << std::endl
+              << "  --noise a          amplitude du décalage des points dominés, relative à l'échelle (0.05)" << std::endl
+              << "  --duplicates f     part des doublons (0)" << std::endl
+              << "  --scale s          objectifs dans [0, s] (1000)" << std::endl
+              << "  --digits p         décimales du format texte (6)" << std::endl
+              << "  --binary           format binaire (aussi pour une sortie en .bin)" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::string output = argv[1];
+    FrontOptions options;
+    int digits = 6;
+    bool binary = output.size() > 4 && output.compare(output.size() - 4, 4, ".bin") == 0;
+
+    try {
+        for (int i = 2; i < argc; i++) {
+            std::string arg = argv[i];
+            if (arg == "--binary") {
+                binary = true;
+                continue;
+            }
+            if (i + 1 >= argc) {
+                usage(argv[0]);
+                return 1;
+            }
+            std::string value = argv[++i];
+            if (arg == "-n") options.N = std::stoull(value);
+            else if (arg == "-d") options.D = std::stoull(value);
+            else if (arg == "--segments") options.segments = std::stoull(value);
+            else if (arg == "--seed") options.seed = std::stoull(value);
+            else if (arg == "--dominated") options.dominatedFraction = std::stod(value);
+            else if (arg == "--noise") options.noise = std::stod(value);
+            else if (arg == "--duplicates") options.duplicateFraction = std::stod(value);
+            else if (arg == "--scale") options.scale = std::stod(value);
+            else if (arg == "--digits") digits = std::stoi(value);
+            else if (arg != "--shape" || !FrontGenerator::parseShape(value, options.shape)) {
+                std::cerr << "Erreur: option inconnue " << arg << " " << value << std::endl;
+                usage(argv[0]);
+                return 1;
+            }
+        }
+
+        FrontGenerator generator(options);
+        auto start = std::chrono::steady_clock::now();
+        bool written = binary ? generator.writeBinary(output) : generator.writeText(output, digits);
+        if (!written) return 1;
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << "✓ " << options.N << " points (D=" << options.D << ", " << FrontGenerator::shapeName(options.shape)
+                  << ", graine " << options.seed << ") écrits dans " << output << (binary ? " (binaire)" : "")
+                  << " en " << seconds << " s" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
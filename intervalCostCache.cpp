@@ -0,0 +1,106 @@
+#include "intervalCostCache.hpp"
+
+void IntervalCostCache::configure(size_t maxEntries) {
+    numSetsPerShard = maxEntries / (NUM_SHARDS * WAYS);
+    if (maxEntries > 0 && numSetsPerShard == 0) numSetsPerShard = 1;
+
+    if (numSetsPerShard == 0) {
+        shards.reset();
+        return;
+    }
+
+    shards.reset(new Shard[NUM_SHARDS]);
+    clear();
+}
+
+void IntervalCostCache::clear() {
+    if (!isEnabled()) return;
+
+    for (size_t s = 0; s < NUM_SHARDS; s++) {
+        std::lock_guard<std::mutex> guard(shards[s].lock);
+        shards[s].entries.assign(numSetsPerShard * WAYS, Entry{EMPTY_KEY, 0.0, false});
+        shards[s].hits = 0;
+        shards[s].misses = 0;
+        shards[s].evictions = 0;
+    }
+}
+
+/**
+ * Looks up the cost of interval [start, end]
+ *
+ * @param start Starting index of the cluster (inclusive)
+ * @param end Ending index of the cluster (inclusive)
+ * @param cost Output: cached cost when found
+ * @return true on a hit
+ */
+bool IntervalCostCache::lookup(unsigned int start, unsigned int end, double& cost) {
+    if (!isEnabled()) return false;
+
+    uint64_t key = makeKey(start, end);
+    uint64_t h = hashKey(key);
+    Shard& shard = shards[h % NUM_SHARDS];
+    size_t set = (h / NUM_SHARDS) % numSetsPerShard;
+
+    std::lock_guard<std::mutex> guard(shard.lock);
+    Entry* ways = &shard.entries[set * WAYS];
+    for (size_t w = 0; w < WAYS; w++) {
+        if (ways[w].key == key) {
+            ways[w].referenced = true;
+            cost = ways[w].cost;
+            shard.hits++;
+            return true;
+        }
+    }
+    shard.misses++;
+    return false;
+}
+
+/**
+ * Stores the cost of interval [start, end]. When the set is full, the first
+ * entry not referenced since the last sweep is evicted (second chance)
+ */
+void IntervalCostCache::insert(unsigned int start, unsigned int end, double cost) {
+    if (!isEnabled()) return;
+
+    uint64_t key = makeKey(start, end);
+    uint64_t h = hashKey(key);
+    Shard& shard = shards[h % NUM_SHARDS];
+    size_t set = (h / NUM_SHARDS) % numSetsPerShard;
+
+    std::lock_guard<std::mutex> guard(shard.lock);
+    Entry* ways = &shard.entries[set * WAYS];
+
+    for (size_t w = 0; w < WAYS; w++) {
+        if (ways[w].key == key || ways[w].key == EMPTY_KEY) {
+            ways[w] = Entry{key, cost, false};
+            return;
+        }
+    }
+
+    // Ensemble plein : au plus deux tours, le premier efface les bits de référence
+    size_t victim = 0;
+    for (size_t step = 0; step < 2 * WAYS; step++) {
+        Entry& candidate = ways[step % WAYS];
+        if (!candidate.referenced) {
+            victim = step % WAYS;
+            break;
+        }
+        candidate.referenced = false;
+    }
+
+    ways[victim] = Entry{key, cost, false};
+    shard.evictions++;
+}
+
+IntervalCostCache::Stats IntervalCostCache::getStats() const {
+    Stats stats{0, 0, 0, numSetsPerShard * NUM_SHARDS * WAYS};
+    if (!isEnabled()) return stats;
+
+    for (size_t s = 0; s < NUM_SHARDS; s++) {
+        std::lock_guard<std::mutex> guard(shards[s].lock);
+        stats.hits += shards[s].hits;
+        stats.misses += shards[s].misses;
+        stats.evictions += shards[s].evictions;
+    }
+    return stats;
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Cache borné et thread-safe des coûts d'intervalle calculateClusterCost(start, end).
+ * Table associative par ensembles (WAYS entrées par ensemble), répartie en shards
+ * protégés chacun par un mutex. Remplacement "seconde chance" (CLOCK) par ensemble.
+ */
+class IntervalCostCache {
+public:
+    struct Stats {
+        size_t hits;
+        size_t misses;
+        size_t evictions;
+        size_t capacity;
+
+        double hitRate() const {
+            size_t total = hits + misses;
+            return total == 0 ? 0.0 : static_cast<double>(hits) / total;
+        }
+    };
+
+    IntervalCostCache() : numSetsPerShard(0) {}
+
+    // Alloue environ maxEntries entrées (au moins un ensemble par shard, 0 : cache désactivé)
+    // et remet les statistiques à zéro
+    void configure(size_t maxEntries);
+    void clear();
+
+    bool isEnabled() const { return numSetsPerShard > 0; }
+    bool lookup(unsigned int start, unsigned int end, double& cost);
+    void insert(unsigned int start, unsigned int end, double cost);
+    Stats getStats() const;
+
+private:
+    static const size_t NUM_SHARDS = 64;
+    static const size_t WAYS = 4;
+    static const uint64_t EMPTY_KEY = ~0ull;
+
+    struct Entry {
+        uint64_t key;
+        double cost;
+        bool referenced;
+    };
+
+    struct Shard {
+        mutable std::mutex lock;
+        std::vector<Entry> entries;
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+    };
+
+    std::unique_ptr<Shard[]> shards;
+    size_t numSetsPerShard;
+
+    static uint64_t makeKey(unsigned int start, unsigned int end) {
+        return (static_cast<uint64_t>(start) << 32) | end;
+    }
+
+    static uint64_t hashKey(uint64_t key) {
+        // splitmix64
+        key += 0x9e3779b97f4a7c15ull;
+        key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ull;
+        key = (key ^ (key >> 27)) * 0x94d049bb133111ebull;
+        return key ^ (key >> 31);
+    }
+};
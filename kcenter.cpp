@@ -0,0 +1,142 @@
+#include "kcenter.hpp"
+#include <iostream>
+#include <limits>
+#include <algorithm>
+#include <random>
+#include <chrono>
+
+/**
+ * Searches the smallest radius accepted by the greedy check among the
+ * pairwise distances: each round draws a distance uniformly among those in
+ * ]lo, hi[ (lo infeasible, hi feasible), counted row by row with two
+ * pointers, and tests it. The candidate set shrinks by half on average, so
+ * O(log N) rounds of O(N). The final greedy partition is completed to K
+ * intervals by splitting off single points, which never increases a radius
+ */
+void KCenter::solve() {
+    if (N == 0 || K == 0 || K > N) {
+        std::cerr << "Erreur: impossible de partitionner " << N << " points en " << K << " clusters" << std::endl;
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    resort();
+    feasibilityChecks = 0;
+
+    size_t c = advanceCenter(0, N - 1, 0);
+    double hi = std::max(distance(0, c), distance(c, N - 1));
+    while (greedyCount(hi) > K) hi = 2.0 * hi + std::numeric_limits<double>::min();
+    double lo = -1.0;
+
+    std::mt19937_64 rng(seed);
+    vector<size_t> first, last;
+    vector<size_t> prefix(N + 1, 0);
+    while (true) {
+        rowBoundaries(lo, false, first);
+        rowBoundaries(hi, true, last);
+        for (size_t i = 0; i < N; i++) {
+            prefix[i + 1] = prefix[i] + (last[i] > first[i] ? last[i] - first[i] : 0);
+        }
+        if (prefix[N] == 0) break;
+
+        size_t k = std::uniform_int_distribution<size_t>(0, prefix[N] - 1)(rng);
+        size_t i = static_cast<size_t>(std::upper_bound(prefix.begin(), prefix.end(), k) - prefix.begin()) - 1;
+        double r = distance(i, first[i] + (k - prefix[i]));
+        // Hors front, les lignes ne sont pas monotones : la recherche s'arrête sur hi (faisable)
+        if (!(r > lo && r < hi)) break;
+
+        feasibilityChecks++;
+        if (greedyCount(r) <= K) hi = r;
+        else lo = r;
+    }
+
+    vector<pair<uint, uint>> greedy;
+    greedyCount(hi, &greedy);
+    solutionInterval.clear();
+    size_t missing = K > greedy.size() ? K - greedy.size() : 0;
+    for (const auto& interval : greedy) {
+        uint detached = static_cast<uint>(std::min<size_t>(missing, interval.second - interval.first));
+        solutionInterval.push_back({interval.first, interval.second - detached});
+        for (uint i = interval.second - detached + 1; i <= interval.second; i++) solutionInterval.push_back({i, i});
+        missing -= detached;
+    }
+
+    intervalCenters.assign(solutionInterval.size(), 0);
+    radii.assign(solutionInterval.size(), 0.0);
+    solutionCost = 0.0;
+    for (size_t k = 0; k < solutionInterval.size(); k++) {
+        size_t s = solutionInterval[k].first, e = solutionInterval[k].second;
+        size_t center = advanceCenter(s, e, s);
+        double radius = 0.0;
+        for (size_t i = s; i <= e; i++) radius = std::max(radius, distance(i, center));
+        intervalCenters[k] = center;
+        radii[k] = radius;
+        solutionCost = std::max(solutionCost, radius);
+    }
+
+    solution.assign(N, 0);
+    computeSolutionFromIntervals();
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    trace() << "K-center par intervalles: rayon " << solutionCost << ", " << feasibilityChecks
+              << " tests de faisabilité, " << seconds << " s" << std::endl;
+}
+
+/**
+ * The radius of [s, e] around c is max(d(s, c), d(c, e)): along a front the
+ * first term grows with c and the second decreases, so c moves right while
+ * the radius does not increase
+ */
+size_t KCenter::advanceCenter(size_t s, size_t e, size_t c) const {
+    double current = std::max(distance(s, c), distance(c, e));
+    while (c < e) {
+        double next = std::max(distance(s, c + 1), distance(c + 1, e));
+        if (next > current) break;
+        current = next;
+        c++;
+    }
+    return c;
+}
+
+/**
+ * Greedy feasibility check: each interval is extended while a representative
+ * within r of both ends exists. The representative only moves right as the
+ * interval grows, so the check is O(N)
+ *
+ * @param r Radius
+ * @param intervals Optional output, the intervals of the greedy partition
+ * @return Number of intervals, stopped at K + 1 when intervals is null
+ */
+size_t KCenter::greedyCount(double r, vector<pair<uint, uint>>* intervals) const {
+    size_t count = 0;
+    size_t s = 0;
+    while (s < N) {
+        count++;
+        if (!intervals && count > K) return count;
+
+        size_t e = s, c = s;
+        while (e + 1 < N) {
+            size_t next = advanceCenter(s, e + 1, c);
+            if (std::max(distance(s, next), distance(next, e + 1)) > r) break;
+            e++;
+            c = next;
+        }
+        if (intervals) intervals->push_back({static_cast<uint>(s), static_cast<uint>(e)});
+        s = e + 1;
+    }
+    return count;
+}
+
+/**
+ * For each i, the first j > i with d(i, j) > r (d(i, j) >= r when strict):
+ * along a front the boundary never moves back when i grows
+ */
+void KCenter::rowBoundaries(double r, bool strict, vector<size_t>& boundary) const {
+    boundary.assign(N, N);
+    size_t j = 1;
+    for (size_t i = 0; i < N; i++) {
+        j = std::max(j, i + 1);
+        while (j < N && (strict ? distance(i, j) < r : distance(i, j) <= r)) j++;
+        boundary[i] = j;
+    }
+}
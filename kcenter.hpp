@@ -0,0 +1,51 @@
+#pragma once
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include "solverInterval.hpp"
+
+/**
+ * K-center par intervalles : partitionne les points triés en K intervalles en
+ * minimisant le plus grand rayon (distance maximale d'un point au représentant de
+ * son intervalle, choisi parmi ses points). Pour un rayon r, un glouton linéaire
+ * étend chaque intervalle tant qu'il existe un représentant à distance <= r des deux
+ * extrémités ; r est cherché par dichotomie sur les distances entre points (tirage
+ * d'une distance candidate restant dans ]infaisable, faisable]), soit O(N log N) en
+ * moyenne sans table K x N.
+ *
+ * Sur un front de Pareto trié, la distance entre deux points croît avec leur écart
+ * dans l'ordre : le rayon d'un intervalle ne dépend que de ses extrémités et la
+ * solution est exacte. Ailleurs, le rayon rendu est recalculé sur tous les points.
+ */
+class KCenter : public SolverInterval {
+public:
+    KCenter() : seed(42), feasibilityChecks(0) {}
+
+    void solve() override;
+
+    void setSeed(uint64_t value) { seed = value; }
+
+    // Indice (ordre trié) du représentant et rayon de chaque intervalle
+    const vector<size_t>& getIntervalCenters() const { return intervalCenters; }
+    const vector<double>& getRadii() const { return radii; }
+    size_t getFeasibilityChecks() const { return feasibilityChecks; }
+
+private:
+    uint64_t seed;
+    size_t feasibilityChecks;
+    vector<size_t> intervalCenters;
+    vector<double> radii;
+
+    inline double distance(size_t i, size_t j) const {
+        return std::sqrt(squaredDistance(i, j));
+    }
+
+    // Meilleur représentant de [s, e] (rayon max(d(s, c), d(c, e))) en partant de c
+    size_t advanceCenter(size_t s, size_t e, size_t c) const;
+
+    // Nombre d'intervalles du glouton pour le rayon r (arrêt dès que K est dépassé)
+    size_t greedyCount(double r, vector<pair<uint, uint>>* intervals = nullptr) const;
+
+    // Pour chaque i, premier j > i avec d(i, j) > r, ou >= r si strict (balayage à deux pointeurs)
+    void rowBoundaries(double r, bool strict, vector<size_t>& boundary) const;
+};
@@ -0,0 +1,167 @@
+#include "kmeansDP.hpp"
+#include <iostream>
+#include <limits>
+#include <algorithm>
+#include <chrono>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * Interval k-means: sorts the points, builds the prefix sums, recovers the
+ * optimal partition by halving K and computes the centroid of each interval.
+ * The reported cost is recomputed directly from the points
+ */
+void KMeansDP::solve() {
+    if (N == 0 || K == 0 || K > N) {
+        std::cerr << "Erreur: impossible de partitionner " << N << " points en " << K << " clusters" << std::endl;
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    resort();
+    computePrefixSums();
+
+    solutionInterval.clear();
+    solutionInterval.reserve(K);
+    partition(0, N, K, solutionInterval);
+
+    centroids.assign(K * D, 0.0);
+    solutionCost = 0.0;
+    for (size_t c = 0; c < solutionInterval.size(); c++) {
+        size_t first = solutionInterval[c].first, last = solutionInterval[c].second;
+        double n = static_cast<double>(last - first + 1);
+        double* centroid = &centroids[c * D];
+        for (size_t i = first; i <= last; i++) {
+            for (size_t d = 0; d < D; d++) centroid[d] += getCoordinate(i, d);
+        }
+        for (size_t d = 0; d < D; d++) centroid[d] /= n;
+        for (size_t i = first; i <= last; i++) {
+            for (size_t d = 0; d < D; d++) {
+                double diff = getCoordinate(i, d) - centroid[d];
+                solutionCost += diff * diff;
+            }
+        }
+    }
+
+    solution.assign(N, 0);
+    computeSolutionFromIntervals();
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    trace() << "K-means par intervalles: coût " << solutionCost << ", " << seconds << " s" << std::endl;
+}
+
+/**
+ * Prefix sums of the coordinates and of their squared norms. The coordinates
+ * are centered on the mean first, which limits the cancellation in
+ * sum of squares - squared sum / n
+ */
+void KMeansDP::computePrefixSums() {
+    mean.assign(D, 0.0);
+    for (size_t i = 0; i < N; i++) {
+        for (size_t d = 0; d < D; d++) mean[d] += getCoordinate(i, d);
+    }
+    for (size_t d = 0; d < D; d++) mean[d] /= static_cast<double>(N);
+
+    prefixSums.assign((N + 1) * D, 0.0);
+    prefixSquares.assign(N + 1, 0.0);
+    for (size_t i = 0; i < N; i++) {
+        double square = 0.0;
+        for (size_t d = 0; d < D; d++) {
+            double x = getCoordinate(i, d) - mean[d];
+            prefixSums[(i + 1) * D + d] = prefixSums[i * D + d] + x;
+            square += x * x;
+        }
+        prefixSquares[i + 1] = prefixSquares[i] + square;
+    }
+}
+
+/**
+ * Last row of the DP restricted to the points [lo, hi) with k clusters.
+ * Forward: row[x] = cost of [lo, lo + x); backward: row[x] = cost of
+ * [hi - x, hi). Only two rows are kept, each filled in O(len log len)
+ */
+void KMeansDP::lastRow(size_t lo, size_t hi, size_t k, bool forward, vector<double>& row) const {
+    size_t len = hi - lo;
+    row.assign(len + 1, std::numeric_limits<double>::infinity());
+    for (size_t x = 1; x <= len; x++) row[x] = splitCost(lo, hi, forward, 0, x);
+
+    vector<double> previous(len + 1);
+    for (size_t j = 2; j <= k; j++) {
+        std::swap(previous, row);
+        std::fill(row.begin(), row.end(), std::numeric_limits<double>::infinity());
+        if (j <= len) fillRange(previous, row, lo, hi, j, forward, j, len, j - 1, len - 1);
+    }
+}
+
+/**
+ * Divide and conquer fill of row[xLo..xHi] for j clusters: the optimal split
+ * of the middle column bounds the splits of the columns on each side
+ * (monotone splits), ties go to the smallest split
+ */
+void KMeansDP::fillRange(const vector<double>& previous, vector<double>& row, size_t lo, size_t hi, size_t j,
+                         bool forward, size_t xLo, size_t xHi, size_t optLo, size_t optHi) const {
+    while (xLo <= xHi) {
+        size_t mid = xLo + (xHi - xLo) / 2;
+        size_t first = std::max(optLo, j - 1);
+        size_t last = std::min(optHi, mid - 1);
+
+        double best = std::numeric_limits<double>::infinity();
+        size_t bestSplit = first;
+        for (size_t y = first; y <= last; y++) {
+            double cost = previous[y] + splitCost(lo, hi, forward, y, mid);
+            if (cost < best) {
+                best = cost;
+                bestSplit = y;
+            }
+        }
+        row[mid] = best;
+
+        // Moitié gauche en récursion, moitié droite en boucle : pile en O(log N)
+        if (mid > xLo) fillRange(previous, row, lo, hi, j, forward, xLo, mid - 1, optLo, bestSplit);
+        xLo = mid + 1;
+        optLo = bestSplit;
+    }
+}
+
+/**
+ * Optimal partition of [lo, hi) into k intervals with O(hi - lo) memory: the
+ * first k/2 clusters end where the forward row (k/2 clusters) plus the
+ * backward row (the other clusters) is minimal, then both halves are solved
+ * the same way. The two rows are independent and computed in parallel
+ */
+void KMeansDP::partition(size_t lo, size_t hi, size_t k, vector<pair<uint, uint>>& intervals) const {
+    if (k == 1) {
+        intervals.push_back({static_cast<uint>(lo), static_cast<uint>(hi - 1)});
+        return;
+    }
+
+    size_t len = hi - lo;
+    size_t kLeft = k / 2, kRight = k - kLeft;
+    size_t cut;
+    {
+        vector<double> forwardRow, backwardRow;
+        bool useParallel = (len > 10000);
+
+#pragma omp parallel sections if(useParallel)
+        {
+#pragma omp section
+            lastRow(lo, hi, kLeft, true, forwardRow);
+#pragma omp section
+            lastRow(lo, hi, kRight, false, backwardRow);
+        }
+
+        double best = std::numeric_limits<double>::infinity();
+        cut = kLeft;
+        for (size_t x = kLeft; x + kRight <= len; x++) {
+            double cost = forwardRow[x] + backwardRow[len - x];
+            if (cost < best) {
+                best = cost;
+                cut = x;
+            }
+        }
+    }
+
+    partition(lo, lo + cut, kLeft, intervals);
+    partition(lo + cut, hi, kRight, intervals);
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <vector>
+#include <utility>
+#include "solverInterval.hpp"
+
+/**
+ * K-means par intervalles sur les points triés : le coût d'un intervalle (somme des
+ * distances carrées à son centroïde) se calcule en O(D) par sommes préfixes et le
+ * split optimal d'une ligne DP est monotone en n, chaque ligne est donc remplie par
+ * diviser pour régner en O(N log N). Seules deux lignes sont gardées : la partition
+ * est reconstruite en coupant K en deux (ligne avant pour les K/2 premiers clusters,
+ * ligne arrière pour les suivants, coupure au minimum de leur somme), soit
+ * O(K N log N) au total avec O(N) mémoire en plus des points.
+ *
+ * Le coût obtenu minore celui de MedoidsDP (même partition, centre libre), et les
+ * intervalles peuvent servir de démarrage à chaud (SolverDP::setWarmStart).
+ */
+class KMeansDP : public SolverInterval {
+public:
+    KMeansDP() {}
+
+    void solve() override;
+
+    // Centroïde de chaque intervalle (K x D, ordre des intervalles)
+    const vector<double>& getCentroids() const { return centroids; }
+
+private:
+    // Sommes préfixes des coordonnées centrées ((N+1) x D) et de leurs normes carrées
+    vector<double> prefixSums;
+    vector<double> prefixSquares;
+    vector<double> mean;
+    vector<double> centroids;
+
+    void computePrefixSums();
+
+    // Somme des distances carrées au centroïde des points [a, b), O(D)
+    inline double intervalCost(size_t a, size_t b) const {
+        double n = static_cast<double>(b - a);
+        const double* sa = &prefixSums[a * D];
+        const double* sb = &prefixSums[b * D];
+        double cross = 0.0;
+        for (size_t d = 0; d < D; d++) {
+            double s = sb[d] - sa[d];
+            cross += s * s;
+        }
+        double cost = (prefixSquares[b] - prefixSquares[a]) - cross / n;
+        return cost > 0.0 ? cost : 0.0;
+    }
+
+    // Coût d'un split dans la ligne avant ([lo + y, lo + x)) ou arrière ([hi - x, hi - y))
+    inline double splitCost(size_t lo, size_t hi, bool forward, size_t y, size_t x) const {
+        return forward ? intervalCost(lo + y, lo + x) : intervalCost(hi - x, hi - y);
+    }
+
+    void lastRow(size_t lo, size_t hi, size_t k, bool forward, vector<double>& row) const;
+    void fillRange(const vector<double>& previous, vector<double>& row, size_t lo, size_t hi, size_t k,
+                   bool forward, size_t xLo, size_t xHi, size_t optLo, size_t optHi) const;
+    void partition(size_t lo, size_t hi, size_t k, vector<pair<uint, uint>>& intervals) const;
+};
@@ -1,11 +1,14 @@
 #include <iostream>
 #include <string>
 #include "medoidsDP.hpp"
+#include "mainOptions.hpp"
 
 int main(int argc, char** argv) {
     std::string filename = "data/very_small_instance_3.txt";
-    if (argc > 1) {
-        filename = argv[1];
+    MainOptions options;
+    if (!options.parse(argc, argv, filename)) {
+        MainOptions::usage(argv[0]);
+        return 1;
     }
 
     std::cout << "===========================================" << std::endl;
@@ -19,6 +22,7 @@ int main(int argc, char** argv) {
         solver.import(filename);
 
         solver.setNbClusters();
+        options.apply(solver);
         std::cout << "Nombre de clusters: " << solver.getNbClusters() << std::endl;
 
         std::cout << "Résolution en cours..." << std::endl;
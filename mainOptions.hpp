@@ -0,0 +1,76 @@
+#pragma once
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include "solverDP.hpp"
+
+// Options des exécutables k-medoids et p-median. Toutes sont désactivées par défaut : sans option,
+// le solveur suit son chemin de base (pas de matrice des distances, pas de cache, remplissage ligne par ligne)
+struct MainOptions {
+    size_t distanceBudgetMB = 0;   // --distances <Mo> : matrice des distances précalculée sous ce budget
+    size_t costCacheEntries = 0;   // --cost-cache <entrées> : mémoïsation des coûts d'intervalle
+    bool tiling = false;           // --tiling : remplissage par tuiles
+    bool wavefront = false;        // --wavefront : remplissage en pipeline
+    bool interleave = false;       // --interleave : table DP répartie sur les nœuds, pages énormes transparentes
+    size_t memoryBudgetMB = 0;     // --memory-budget <Mo> : lignes DP déversées sur disque au-delà
+
+    static void usage(const char* program) {
+        std::cerr << "Usage: " << program << " [fichier] [--distances Mo] [--cost-cache entrées] [--tiling]"
+                  << " [--wavefront] [--interleave] [--memory-budget Mo]" << std::endl;
+    }
+
+    // Le premier argument qui n'est pas une option est le fichier d'instance ; false si un argument est invalide
+    bool parse(int argc, char** argv, std::string& filename) {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            if (arg == "--tiling") {
+                tiling = true;
+            } else if (arg == "--wavefront") {
+                wavefront = true;
+            } else if (arg == "--interleave") {
+                interleave = true;
+            } else if (arg == "--distances" || arg == "--cost-cache" || arg == "--memory-budget") {
+                size_t value;
+                if (i + 1 >= argc || !parseCount(argv[i + 1], value)) {
+                    std::cerr << "Erreur: " << arg << " attend un nombre entier" << std::endl;
+                    return false;
+                }
+                i++;
+                if (arg == "--distances") distanceBudgetMB = value;
+                else if (arg == "--cost-cache") costCacheEntries = value;
+                else memoryBudgetMB = value;
+            } else if (arg.compare(0, 2, "--") == 0) {
+                std::cerr << "Erreur: option inconnue " << arg << std::endl;
+                return false;
+            } else {
+                filename = arg;
+            }
+        }
+        return true;
+    }
+
+    void apply(SolverDP& solver) const {
+        if (distanceBudgetMB > 0) solver.setDistanceMatrixBudget(distanceBudgetMB << 20);
+        if (costCacheEntries > 0) solver.setCostCacheCapacity(costCacheEntries);
+        solver.setFillTiling(tiling);
+        solver.setWavefrontFill(wavefront);
+        if (interleave) {
+            MemoryPolicy memory;
+            memory.placement = MemoryPlacement::INTERLEAVE;
+            memory.transparentHugePages = true;
+            solver.setMemoryPolicy(memory);
+        }
+        if (memoryBudgetMB > 0) solver.setMemoryBudget(memoryBudgetMB << 20);
+    }
+
+private:
+    static bool parseCount(const std::string& text, size_t& value) {
+        if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos) return false;
+        try {
+            value = std::stoull(text);
+        } catch (const std::out_of_range&) {
+            return false;
+        }
+        return true;
+    }
+};
@@ -2,46 +2,61 @@
 #include <vector>
 #include <stdexcept>
 #include <iostream>
+#include "memoryPolicy.hpp"
 
+// Matrice contiguë (ligne par ligne), allouée selon une MemoryPolicy et initialisée à 0
 class MatrixDouble {
 private:
-    std::vector<std::vector<double>> data;
+    PolicyBuffer<double> data;
     size_t rows;
     size_t cols;
 
 public:
     MatrixDouble() : rows(0), cols(0) {}
 
-    void initMatrix(size_t numRows, size_t numCols) {
+    // Les pages d'une grande matrice ne sont pas touchées ici : le premier accès décide du placement
+    void initMatrix(size_t numRows, size_t numCols, const MemoryPolicy& policy = MemoryPolicy()) {
         rows = numRows;
         cols = numCols;
-        data.clear();
-        data.resize(rows);
-        for (size_t i = 0; i < rows; ++i) {
-            data[i].resize(cols, 0.0);
-        }
+        data.allocate(rows * cols, policy);
     }
 
     double getElement(size_t rowIndex, size_t colIndex) const {
         if (rowIndex >= rows || colIndex >= cols) {
             throw std::out_of_range("Matrix index out of bounds");
         }
-        return data[rowIndex][colIndex];
+        return data[rowIndex * cols + colIndex];
     }
 
     void setElement(size_t rowIndex, size_t colIndex, double value) {
         if (rowIndex >= rows || colIndex >= cols) {
             throw std::out_of_range("Matrix index out of bounds");
         }
-        data[rowIndex][colIndex] = value;
+        data[rowIndex * cols + colIndex] = value;
+    }
+
+    // Début de la ligne rowIndex (cols valeurs)
+    const double* getRow(size_t rowIndex) const {
+        if (rowIndex >= rows) {
+            throw std::out_of_range("Matrix index out of bounds");
+        }
+        return data.data() + rowIndex * cols;
+    }
+
+    double* getRow(size_t rowIndex) {
+        if (rowIndex >= rows) {
+            throw std::out_of_range("Matrix index out of bounds");
+        }
+        return data.data() + rowIndex * cols;
     }
 
     size_t getRows() const { return rows; }
     size_t getCols() const { return cols; }
+    const AllocationReport& getAllocation() const { return data.getReport(); }
 
     void deleteMatrix() {
-        data.clear();
+        data.release();
         rows = 0;
         cols = 0;
     }
-};
\ No newline at end of file
+};
@@ -5,7 +5,6 @@ class MedianDP : public SolverDP {
 protected:
     void clusterCostsBefore(uint i, vector<double>& v) override;
     void clusterCostsFromBeginning(vector<double>& v) override;
-
-private:
-    double calculateClusterCost(uint start, uint end) const;
+    bool usesSquaredDistance() const override { return false; }
+    double calculateClusterCost(uint start, uint end) const override;
 };
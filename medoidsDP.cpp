@@ -14,8 +14,6 @@
  * @param v Output vector where v[j] = cost of cluster with j+1 points ending at i
  */
 void MedoidsDP::clusterCostsBefore(uint i, vector<double>& v) {
-    std::cout << "DEBUG clusterCostsBefore: i=" << i << " v.size()=" << v.size() << std::endl;
-
     std::fill(v.begin(), v.end(), std::numeric_limits<double>::max());
 
     if (v.size() == 0 || i >= N) return;
@@ -28,6 +26,8 @@ void MedoidsDP::clusterCostsBefore(uint i, vector<double>& v) {
 
 #pragma omp parallel for if(useParallel) schedule(dynamic)
     for (uint numPoints = 1; numPoints <= maxPoints; numPoints++) {
+        // Solve borné : chaque coût peut coûter O(len²), l'échéance est vérifiée avant chacun
+        if (fillInterrupted()) continue;
         uint clusterStart = i - numPoints + 1;
         uint clusterEnd = i;
 
@@ -35,13 +35,13 @@ void MedoidsDP::clusterCostsBefore(uint i, vector<double>& v) {
             continue;
         }
 
-        double cost = calculateClusterCost(clusterStart, clusterEnd);
+        double cost = clusterCost(clusterStart, clusterEnd);
         v[numPoints - 1] = cost;
 
 /*
 #pragma omp critical
         {
-            std::cout << "DEBUG: v[" << (numPoints - 1) << "] = " << cost
+            trace() << "DEBUG: v[" << (numPoints - 1) << "] = " << cost
                       << " (cluster [" << clusterStart << ", " << clusterEnd << "], "
                       << numPoints << " points)" << std::endl;
         }
@@ -56,8 +56,6 @@ void MedoidsDP::clusterCostsBefore(uint i, vector<double>& v) {
  * @param v Output vector where v[j] = cost of cluster with first j+1 points
  */
 void MedoidsDP::clusterCostsFromBeginning(vector<double>& v) {
-    std::cout << "DEBUG clusterCostsFromBeginning: v.size()=" << v.size() << std::endl;
-
     std::fill(v.begin(), v.end(), std::numeric_limits<double>::max());
 
     if (v.size() == 0) return;
@@ -70,6 +68,7 @@ void MedoidsDP::clusterCostsFromBeginning(vector<double>& v) {
 
 #pragma omp parallel for if(useParallel) schedule(dynamic)
     for (uint numPoints = 1; numPoints <= maxPoints; numPoints++) {
+        if (fillInterrupted()) continue;
         uint clusterStart = 0;
         uint clusterEnd = numPoints - 1;
 
@@ -77,13 +76,13 @@ void MedoidsDP::clusterCostsFromBeginning(vector<double>& v) {
             continue;
         }
 
-        double cost = calculateClusterCost(clusterStart, clusterEnd);
+        double cost = clusterCost(clusterStart, clusterEnd);
         v[numPoints - 1] = cost;
 
 /*
 #pragma omp critical
         {
-            std::cout << "DEBUG: v[" << (numPoints - 1) << "] = " << cost
+            trace() << "DEBUG: v[" << (numPoints - 1) << "] = " << cost
                       << " (cluster [" << clusterStart << ", " << clusterEnd << "], "
                       << numPoints << " points)" << std::endl;
         }
@@ -113,7 +112,7 @@ double MedoidsDP::calculateClusterCost(uint start, uint end) const {
 /*
 #pragma omp critical
     {
-        std::cout << "    calculateClusterCost [" << start << ", " << end << "]:" << std::endl;
+        trace() << "    calculateClusterCost [" << start << ", " << end << "]:" << std::endl;
     }
 */
 
@@ -124,13 +123,13 @@ double MedoidsDP::calculateClusterCost(uint start, uint end) const {
         // Calcul séquentiel des distances pour chaque médoïde
         for (uint i = start; i <= end; i++) {
             if (i != medoid) {
-                double dist = squaredDistance(i, medoid);
-                cost += dist;
+                double dist = d.isBuilt() ? d.get(i, medoid) : squaredDistance(i, medoid);
+                cost += pointWeight(i) * dist;
 
 /*
 #pragma omp critical
                 {
-                    std::cout << "      dist(" << i << ", " << medoid << ") = " << dist << std::endl;
+                    trace() << "      dist(" << i << ", " << medoid << ") = " << dist << std::endl;
                 }
 */
             }
@@ -139,7 +138,7 @@ double MedoidsDP::calculateClusterCost(uint start, uint end) const {
 /*
 #pragma omp critical
         {
-            std::cout << "    medoid " << medoid << ": cost = " << cost << std::endl;
+            trace() << "    medoid " << medoid << ": cost = " << cost << std::endl;
         }
 */
 
@@ -151,7 +150,7 @@ double MedoidsDP::calculateClusterCost(uint start, uint end) const {
 /*
 #pragma omp critical
     {
-        std::cout << "    --> minCost = " << minCost << std::endl;
+        trace() << "    --> minCost = " << minCost << std::endl;
     }
 */
 
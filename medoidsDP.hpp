@@ -6,8 +6,5 @@ protected:
     void clusterCostsBefore(uint i, vector<double>& v) override;
     void clusterCostsFromBeginning(vector<double>& v) override;
 
-    double calculateClusterCost(uint start, uint end) const;
-
-private:
-    MatrixDouble d;
+    double calculateClusterCost(uint start, uint end) const override;
 };
\ No newline at end of file
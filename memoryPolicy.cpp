@@ -0,0 +1,203 @@
+#include "memoryPolicy.hpp"
+#include <cstdlib>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <new>
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <linux/mempolicy.h>
+#endif
+
+namespace {
+
+const size_t HUGE_PAGE_SIZE = size_t(2) << 20;
+
+size_t roundUp(size_t value, size_t multiple) {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+/**
+ * Parses a sysfs node list such as "0-3,6" into a bit mask
+ *
+ * @param list Node list as found in /sys/devices/system/node/online
+ * @param mask Output: one bit per listed node (nodes >= 64 are ignored)
+ * @return Number of nodes in the mask
+ */
+int parseNodeList(const std::string& list, uint64_t& mask) {
+    mask = 0;
+    std::stringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty()) continue;
+        size_t dash = range.find('-');
+        int first = std::atoi(range.substr(0, dash).c_str());
+        int last = dash == std::string::npos ? first : std::atoi(range.substr(dash + 1).c_str());
+        for (int node = first; node <= last && node < 64; node++) {
+            if (node >= 0) mask |= uint64_t(1) << node;
+        }
+    }
+
+    int count = 0;
+    for (uint64_t m = mask; m != 0; m &= m - 1) count++;
+    return count;
+}
+
+int readNodeMask(uint64_t& mask) {
+    std::ifstream file("/sys/devices/system/node/online");
+    std::string list;
+    if (!file || !std::getline(file, list)) {
+        mask = 1;
+        return 1;
+    }
+    int count = parseNodeList(list, mask);
+    if (count == 0) {
+        mask = 1;
+        return 1;
+    }
+    return count;
+}
+
+#ifdef __linux__
+bool interleave(void* ptr, size_t bytes, unsigned flags) {
+    uint64_t mask;
+    if (readNodeMask(mask) < 2) return false;
+    unsigned long nodeMask = static_cast<unsigned long>(mask);
+    return syscall(SYS_mbind, ptr, bytes, MPOL_INTERLEAVE, &nodeMask, 64, flags) == 0;
+}
+
+void adviseHugePages(void* ptr, size_t bytes, AllocationReport& report) {
+#ifdef MADV_HUGEPAGE
+    report.transparentHugePages = madvise(ptr, bytes, MADV_HUGEPAGE) == 0;
+#else
+    (void)ptr;
+    (void)bytes;
+    (void)report;
+#endif
+}
+#endif
+
+}
+
+namespace memoryPolicy {
+
+int onlineNumaNodes() {
+    uint64_t mask;
+    return readNodeMask(mask);
+}
+
+/**
+ * Allocates a zero-filled buffer following the policy. Large buffers are mapped
+ * anonymously and left untouched, so that physical pages are placed by the
+ * threads that write them first (or interleaved by mbind beforehand). Explicit
+ * huge pages fall back to transparent huge pages when none are reserved
+ *
+ * @param bytes Requested size
+ * @param policy Placement and huge page policy
+ * @param report Output: what was actually obtained
+ * @return Pointer to the buffer (throws std::bad_alloc on failure)
+ */
+void* allocate(size_t bytes, const MemoryPolicy& policy, AllocationReport& report) {
+    report = AllocationReport();
+    report.bytes = bytes;
+    report.numaNodes = onlineNumaNodes();
+
+#ifdef __linux__
+    if (bytes >= policy.hugePageThreshold) {
+        bool wantHuge = policy.transparentHugePages || policy.explicitHugePages;
+        size_t length = wantHuge ? roundUp(bytes, HUGE_PAGE_SIZE) : bytes;
+        void* ptr = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+        if (policy.explicitHugePages) {
+            ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            report.explicitHugePages = ptr != MAP_FAILED;
+        }
+#endif
+        if (ptr == MAP_FAILED) {
+            ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (ptr != MAP_FAILED && wantHuge) adviseHugePages(ptr, length, report);
+        }
+
+        if (ptr != MAP_FAILED) {
+            report.bytes = length;
+            report.mapped = true;
+            if (policy.placement == MemoryPlacement::INTERLEAVE) {
+                report.interleaved = interleave(ptr, length, 0);
+            }
+            report.firstTouch = policy.placement == MemoryPlacement::FIRST_TOUCH;
+            return ptr;
+        }
+    }
+#endif
+
+    void* ptr = std::calloc(bytes, 1);
+    if (ptr == nullptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void release(void* ptr, const AllocationReport& report) {
+#ifdef __linux__
+    if (report.mapped) {
+        munmap(ptr, report.bytes);
+        return;
+    }
+#endif
+    std::free(ptr);
+}
+
+/**
+ * Applies the policy to an existing buffer (e.g. the points vector). Interleaving
+ * migrates pages already touched; huge page advice only affects future faults
+ * and khugepaged. Only whole pages inside the buffer are affected
+ */
+void apply(void* ptr, size_t bytes, const MemoryPolicy& policy, AllocationReport& report) {
+    report = AllocationReport();
+    report.bytes = bytes;
+    report.numaNodes = onlineNumaNodes();
+
+#ifdef __linux__
+    if (bytes < policy.hugePageThreshold) return;
+
+    size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t begin = roundUp(reinterpret_cast<uintptr_t>(ptr), pageSize);
+    uintptr_t end = (reinterpret_cast<uintptr_t>(ptr) + bytes) / pageSize * pageSize;
+    if (end <= begin) return;
+
+    void* pages = reinterpret_cast<void*>(begin);
+    size_t length = end - begin;
+    if (policy.transparentHugePages || policy.explicitHugePages) adviseHugePages(pages, length, report);
+    if (policy.placement == MemoryPlacement::INTERLEAVE) {
+        report.interleaved = interleave(pages, length, MPOL_MF_MOVE);
+    }
+#else
+    (void)ptr;
+    (void)policy;
+#endif
+}
+
+}
+
+std::string MemoryPolicy::describe() const {
+    std::ostringstream out;
+    out << (placement == MemoryPlacement::FIRST_TOUCH ? "premier-accès"
+            : placement == MemoryPlacement::INTERLEAVE ? "entrelacé" : "défaut");
+    if (explicitHugePages) out << ", pages énormes explicites";
+    else if (transparentHugePages) out << ", pages énormes transparentes";
+    return out.str();
+}
+
+std::string AllocationReport::describe() const {
+    std::ostringstream out;
+    if (bytes >= (size_t(1) << 20)) out << bytes / (size_t(1) << 20) << " Mo";
+    else out << bytes / 1024 << " Ko";
+    out << ", " << (mapped ? "mmap" : "tas");
+    if (firstTouch) out << ", premier-accès";
+    if (interleaved) out << ", entrelacé sur " << numaNodes << " nœuds";
+    if (explicitHugePages) out << ", hugetlb";
+    else if (transparentHugePages) out << ", THP";
+    return out.str();
+}
@@ -0,0 +1,113 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <algorithm>
+
+/**
+ * Politique d'allocation des grands tampons du solveur (table DP, coûts, distances, points) :
+ * placement NUMA (premier accès ou entrelacement) et pages énormes (transparentes ou explicites).
+ * Les tampons sous hugePageThreshold restent sur le tas.
+ */
+enum class MemoryPlacement {
+    DEFAULT,     // Placement du noyau (premier accès quelconque)
+    FIRST_TOUCH, // Premier accès par les threads qui rempliront les données (ordonnancement statique)
+    INTERLEAVE   // Pages réparties sur tous les nœuds NUMA
+};
+
+struct MemoryPolicy {
+    MemoryPlacement placement = MemoryPlacement::DEFAULT;
+    bool transparentHugePages = false; // madvise(MADV_HUGEPAGE)
+    bool explicitHugePages = false;    // MAP_HUGETLB, repli sur les pages transparentes
+    size_t hugePageThreshold = size_t(2) << 20;
+
+    std::string describe() const;
+};
+
+// Ce qui a réellement été obtenu pour un tampon
+struct AllocationReport {
+    size_t bytes = 0;
+    bool mapped = false;        // mmap (sinon tas)
+    bool interleaved = false;
+    bool firstTouch = false;
+    bool transparentHugePages = false;
+    bool explicitHugePages = false;
+    int numaNodes = 1;
+
+    std::string describe() const;
+};
+
+namespace memoryPolicy {
+
+// Allocation mise à zéro, sans toucher les pages des grands tampons
+void* allocate(size_t bytes, const MemoryPolicy& policy, AllocationReport& report);
+void release(void* ptr, const AllocationReport& report);
+
+// Applique la politique à un tampon déjà alloué (entrelacement avec migration, pages transparentes)
+void apply(void* ptr, size_t bytes, const MemoryPolicy& policy, AllocationReport& report);
+
+int onlineNumaNodes();
+
+}
+
+/**
+ * Tampon contigu de T alloué selon une MemoryPolicy, initialisé à zéro.
+ * Copie profonde (même politique), déplacement sans copie.
+ */
+template <typename T>
+class PolicyBuffer {
+private:
+    T* ptr;
+    size_t count;
+    MemoryPolicy policy;
+    AllocationReport report;
+
+public:
+    PolicyBuffer() : ptr(nullptr), count(0) {}
+
+    PolicyBuffer(const PolicyBuffer& other) : ptr(nullptr), count(0) {
+        allocate(other.count, other.policy);
+        if (count > 0) std::copy(other.ptr, other.ptr + count, ptr);
+    }
+
+    PolicyBuffer(PolicyBuffer&& other) noexcept
+            : ptr(other.ptr), count(other.count), policy(other.policy), report(other.report) {
+        other.ptr = nullptr;
+        other.count = 0;
+    }
+
+    PolicyBuffer& operator=(PolicyBuffer other) {
+        std::swap(ptr, other.ptr);
+        std::swap(count, other.count);
+        std::swap(policy, other.policy);
+        std::swap(report, other.report);
+        return *this;
+    }
+
+    ~PolicyBuffer() { release(); }
+
+    void allocate(size_t numElements, const MemoryPolicy& memoryPolicy = MemoryPolicy()) {
+        release();
+        policy = memoryPolicy;
+        if (numElements == 0) return;
+        ptr = static_cast<T*>(memoryPolicy::allocate(numElements * sizeof(T), policy, report));
+        count = numElements;
+    }
+
+    void release() {
+        if (ptr != nullptr) memoryPolicy::release(ptr, report);
+        ptr = nullptr;
+        count = 0;
+        report = AllocationReport();
+    }
+
+    T* data() { return ptr; }
+    const T* data() const { return ptr; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    T& operator[](size_t i) { return ptr[i]; }
+    const T& operator[](size_t i) const { return ptr[i]; }
+
+    const AllocationReport& getReport() const { return report; }
+};
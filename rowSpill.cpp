@@ -0,0 +1,165 @@
+#include "rowSpill.hpp"
+#include <stdexcept>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+RowSpillFile::RowSpillFile()
+        : fd(-1), base(nullptr), rows(0), cols(0), stride(0), mappedBytes(0),
+          queueDepth(4), inFlight(0), stopping(false) {}
+
+RowSpillFile::~RowSpillFile() {
+    close();
+}
+
+/**
+ * Creates and maps the scratch file. Each row occupies a page-aligned record
+ * (numCols costs then numCols argmins), so that writeback, eviction and
+ * prefetch work on whole pages of a single row
+ *
+ * @param directory Directory of the scratch file
+ * @param numRows Number of DP rows (K)
+ * @param numCols Number of columns (N)
+ * @param queueDepth Maximum number of rows waiting for the writer thread
+ */
+void RowSpillFile::open(const std::string& directory, size_t numRows, size_t numCols, size_t queueDepth) {
+    close();
+
+    std::string path = directory + "/clustering-dp-XXXXXX";
+    std::vector<char> name(path.begin(), path.end());
+    name.push_back('\0');
+
+    fd = mkstemp(name.data());
+    if (fd < 0) {
+        throw std::runtime_error("Impossible de créer le fichier temporaire dans " + directory);
+    }
+    unlink(name.data()); // Supprimé à la fermeture
+
+    size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    rows = numRows;
+    cols = numCols;
+    stride = (cols * (sizeof(double) + sizeof(uint32_t)) + pageSize - 1) / pageSize * pageSize;
+    mappedBytes = rows * stride;
+
+    if (ftruncate(fd, static_cast<off_t>(mappedBytes)) != 0) {
+        ::close(fd);
+        fd = -1;
+        throw std::runtime_error("Impossible de dimensionner le fichier temporaire (" + std::to_string(mappedBytes) + " octets)");
+    }
+
+    void* ptr = mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (ptr == MAP_FAILED) {
+        ::close(fd);
+        fd = -1;
+        throw std::runtime_error("Impossible de projeter le fichier temporaire en mémoire");
+    }
+    base = static_cast<char*>(ptr);
+
+    this->queueDepth = queueDepth > 0 ? queueDepth : 1;
+    inFlight = 0;
+    stopping = false;
+    writer = std::thread(&RowSpillFile::writerLoop, this);
+}
+
+void RowSpillFile::close() {
+    if (writer.joinable()) {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            stopping = true;
+        }
+        changed.notify_all();
+        writer.join();
+    }
+    queue.clear();
+
+    if (base != nullptr) munmap(base, mappedBytes);
+    if (fd >= 0) ::close(fd);
+    base = nullptr;
+    fd = -1;
+    rows = cols = stride = mappedBytes = 0;
+}
+
+void RowSpillFile::writeRow(size_t row, const double* costs, std::vector<uint32_t>&& argmins) {
+    PendingRow pending{row, std::vector<double>(costs, costs + cols), std::move(argmins)};
+
+    std::unique_lock<std::mutex> guard(lock);
+    changed.wait(guard, [this] { return queue.size() < queueDepth; });
+    queue.push_back(std::move(pending));
+    guard.unlock();
+    changed.notify_all();
+}
+
+void RowSpillFile::flush() {
+    std::unique_lock<std::mutex> guard(lock);
+    changed.wait(guard, [this] { return queue.empty() && inFlight == 0; });
+}
+
+/**
+ * Writer thread: copies each pending row into the mapping and starts its
+ * writeback; the previous row, whose writeback has had a full row of fill time
+ * to complete, is then waited for and dropped from memory
+ */
+void RowSpillFile::writerLoop() {
+    std::unique_lock<std::mutex> guard(lock);
+    while (true) {
+        changed.wait(guard, [this] { return stopping || !queue.empty(); });
+        if (queue.empty()) return;
+
+        PendingRow pending = std::move(queue.front());
+        queue.pop_front();
+        inFlight++;
+        guard.unlock();
+        changed.notify_all();
+
+        char* record = base + pending.row * stride;
+        std::memcpy(record, pending.costs.data(), cols * sizeof(double));
+        std::memcpy(record + cols * sizeof(double), pending.argmins.data(),
+                    std::min(cols, pending.argmins.size()) * sizeof(uint32_t));
+        startWriteback(pending.row);
+        if (pending.row > 0) evict(pending.row - 1);
+
+        guard.lock();
+        inFlight--;
+        changed.notify_all();
+    }
+}
+
+void RowSpillFile::startWriteback(size_t row) {
+#ifdef __linux__
+    sync_file_range(fd, static_cast<off_t>(row * stride), static_cast<off_t>(stride), SYNC_FILE_RANGE_WRITE);
+#else
+    (void)row;
+#endif
+}
+
+void RowSpillFile::evict(size_t row) {
+    off_t offset = static_cast<off_t>(row * stride);
+#ifdef __linux__
+    sync_file_range(fd, offset, static_cast<off_t>(stride),
+                    SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER);
+#else
+    msync(base + offset, stride, MS_SYNC);
+#endif
+    madvise(base + offset, stride, MADV_DONTNEED);
+#ifdef POSIX_FADV_DONTNEED
+    posix_fadvise(fd, offset, static_cast<off_t>(stride), POSIX_FADV_DONTNEED);
+#endif
+}
+
+void RowSpillFile::prefetch(size_t row) const {
+    if (base == nullptr || row >= rows) return;
+    madvise(base + row * stride, stride, MADV_WILLNEED);
+}
+
+const double* RowSpillFile::costRow(size_t row) const {
+    if (row >= rows) throw std::out_of_range("Spill row out of bounds");
+    return reinterpret_cast<const double*>(base + row * stride);
+}
+
+const uint32_t* RowSpillFile::argminRow(size_t row) const {
+    if (row >= rows) throw std::out_of_range("Spill row out of bounds");
+    return reinterpret_cast<const uint32_t*>(base + row * stride + cols * sizeof(double));
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <vector>
+#include <deque>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Fichier temporaire projeté en mémoire recevant les lignes terminées de la DP
+ * (coûts et argmin), écrites séquentiellement par un thread d'écriture différée.
+ * Une ligne écrite est renvoyée au disque puis libérée de la mémoire ; le
+ * backtracking la relit par projection avec préchargement de la ligne suivante.
+ */
+class RowSpillFile {
+public:
+    RowSpillFile();
+    ~RowSpillFile();
+
+    RowSpillFile(const RowSpillFile&) = delete;
+    RowSpillFile& operator=(const RowSpillFile&) = delete;
+
+    // Crée le fichier (supprimé dès son ouverture) dans directory ; lève std::runtime_error en cas d'échec
+    void open(const std::string& directory, size_t numRows, size_t numCols, size_t queueDepth = 4);
+    void close();
+    bool isOpen() const { return base != nullptr; }
+
+    // Copie la ligne et la confie au thread d'écriture (bloque si queueDepth lignes sont en attente)
+    void writeRow(size_t row, const double* costs, std::vector<uint32_t>&& argmins);
+    // Attend que toutes les lignes confiées soient écrites
+    void flush();
+
+    void prefetch(size_t row) const;
+    const double* costRow(size_t row) const;
+    const uint32_t* argminRow(size_t row) const;
+
+    size_t getBytes() const { return mappedBytes; }
+
+private:
+    struct PendingRow {
+        size_t row;
+        std::vector<double> costs;
+        std::vector<uint32_t> argmins;
+    };
+
+    int fd;
+    char* base;
+    size_t rows;
+    size_t cols;
+    size_t stride;      // Octets par ligne (coûts puis argmin), multiple de la taille de page
+    size_t mappedBytes;
+
+    std::thread writer;
+    std::mutex lock;
+    std::condition_variable changed;
+    std::deque<PendingRow> queue;
+    size_t queueDepth;
+    size_t inFlight;
+    bool stopping;
+
+    void writerLoop();
+    void startWriteback(size_t row);
+    void evict(size_t row);
+};
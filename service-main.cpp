@@ -0,0 +1,156 @@
+#include "service.hpp"
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <cstring>
+#include <csignal>
+#include <cerrno>
+#include <vector>
+#include <chrono>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Tampon qui ignore tout : les traces des solveurs sur std::cout ne sont pas écrites
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+};
+
+// Longueur maximale d'une ligne de requête : au-delà, la connexion est fermée
+static const size_t MAX_REQUEST_BYTES = 4096;
+// Une connexion sans données pendant ce temps est fermée
+static const std::chrono::seconds IDLE_TIMEOUT(300);
+// Attente maximale d'un client qui ne lit pas sa réponse
+static const int SEND_TIMEOUT_MS = 5000;
+// Réveil de la boucle sans activité (connexions inactives, arrêt)
+static const int POLL_INTERVAL_MS = 1000;
+
+struct Connection {
+    int fd;
+    std::string pending;  // Début de la requête suivante
+    std::chrono::steady_clock::time_point lastActivity;
+};
+
+// Écrit toute la réponse sur une socket non bloquante, false si le client est parti ou ne lit plus
+static bool sendAll(int fd, const std::string& data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t n = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (n > 0) {
+            sent += static_cast<size_t>(n);
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+            pollfd writable = {fd, POLLOUT, 0};
+            if (poll(&writable, 1, SEND_TIMEOUT_MS) > 0) continue;
+        }
+        return false;
+    }
+    return true;
+}
+
+// Lit les données disponibles de la connexion et traite ses requêtes complètes, une par ligne ;
+// false si la connexion doit être fermée
+static bool serve(Connection& connection, ClusteringService& service) {
+    char buffer[4096];
+    ssize_t n = recv(connection.fd, buffer, sizeof(buffer), 0);
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) return true;
+    if (n <= 0) return false;
+    connection.pending.append(buffer, static_cast<size_t>(n));
+    connection.lastActivity = std::chrono::steady_clock::now();
+
+    size_t end;
+    while ((end = connection.pending.find('\n')) != std::string::npos && end <= MAX_REQUEST_BYTES) {
+        std::string request = connection.pending.substr(0, end);
+        connection.pending.erase(0, end + 1);
+        if (!request.empty() && request.back() == '\r') request.pop_back();
+        if (request.empty()) continue;
+
+        std::string response = service.handle(request);
+        std::cerr << "> " << request << " : " << response.substr(0, response.find('\n')) << std::endl;
+        if (!sendAll(connection.fd, response) || service.isStopping()) return false;
+    }
+
+    if (connection.pending.size() > MAX_REQUEST_BYTES) {
+        sendAll(connection.fd, "ERR requête de plus de " + std::to_string(MAX_REQUEST_BYTES) + " octets\n");
+        std::cerr << "> requête de plus de " << MAX_REQUEST_BYTES << " octets, connexion fermée" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 2) {
+        std::cerr << "Usage: " << argv[0] << " <socket>" << std::endl;
+        return 1;
+    }
+    std::string path = argv[1];
+
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) {
+        std::cerr << "Erreur: chemin de socket trop long" << std::endl;
+        return 1;
+    }
+    std::strcpy(address.sun_path, path.c_str());
+
+    int server = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(path.c_str());
+    if (server < 0 || bind(server, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 || listen(server, 16) < 0) {
+        std::cerr << "Erreur: impossible d'écouter sur " << path << " (" << std::strerror(errno) << ")" << std::endl;
+        return 1;
+    }
+    signal(SIGPIPE, SIG_IGN);
+
+    NullBuffer silent;
+    std::streambuf* previous = std::cout.rdbuf(&silent);
+    std::cerr << "Service de clustering à l'écoute sur " << path << std::endl;
+
+    // Une seule boucle sert toutes les connexions : les requêtes sont traitées l'une après l'autre (les tables DP
+    // ne sont pas partagées entre threads), mais un client inactif ou lent ne bloque pas les autres
+    ClusteringService service;
+    std::vector<Connection> connections;
+    while (!service.isStopping()) {
+        std::vector<pollfd> descriptors = {{server, POLLIN, 0}};
+        for (const Connection& connection : connections) descriptors.push_back({connection.fd, POLLIN, 0});
+        if (poll(descriptors.data(), descriptors.size(), POLL_INTERVAL_MS) < 0 && errno != EINTR) {
+            std::cerr << "Erreur: poll (" << std::strerror(errno) << ")" << std::endl;
+            break;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        std::vector<Connection> open;
+        for (size_t i = 0; i < connections.size(); i++) {
+            Connection& connection = connections[i];
+            bool keep;
+            if (descriptors[i + 1].revents != 0) {
+                keep = serve(connection, service);
+            } else {
+                keep = now - connection.lastActivity < IDLE_TIMEOUT;
+                if (!keep) std::cerr << "> connexion inactive fermée" << std::endl;
+            }
+            if (keep && !service.isStopping()) open.push_back(std::move(connection));
+            else close(connection.fd);
+        }
+        connections = std::move(open);
+
+        if (descriptors[0].revents & POLLIN) {
+            int client = accept(server, nullptr, nullptr);
+            if (client >= 0) {
+                fcntl(client, F_SETFL, fcntl(client, F_GETFL) | O_NONBLOCK);
+                connections.push_back(Connection{client, "", now});
+            }
+        }
+    }
+    for (const Connection& connection : connections) close(connection.fd);
+
+    close(server);
+    unlink(path.c_str());
+    std::cout.rdbuf(previous);
+    std::cerr << "Service arrêté" << std::endl;
+    return 0;
+}
@@ -0,0 +1,270 @@
+#include "service.hpp"
+#include "medoidsDP.hpp"
+#include "medianDP.hpp"
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <limits>
+#include <exception>
+
+namespace {
+
+// Budget mémoire pour la matrice des distances précalculée de chaque solveur (512 Mo)
+const size_t DISTANCE_MATRIX_BUDGET = size_t(512) << 20;
+// Nombre maximal de coûts d'intervalle mémoïsés par solveur
+const size_t COST_CACHE_ENTRIES = size_t(1) << 20;
+
+std::string error(const std::string& message) {
+    return "ERR " + message + "\n";
+}
+
+// "OK n" suivi des n lignes
+std::string ok(const std::vector<std::string>& lines) {
+    std::string response = "OK " + std::to_string(lines.size()) + "\n";
+    for (const std::string& line : lines) response += line + "\n";
+    return response;
+}
+
+bool parseCount(const std::string& text, size_t& value) {
+    if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos) return false;
+    value = std::stoul(text);
+    return true;
+}
+
+std::string formatCost(double cost) {
+    if (cost == std::numeric_limits<double>::max()) return "inf";
+    std::ostringstream out;
+    out << std::setprecision(17) << cost;
+    return out.str();
+}
+
+}
+
+void LatencyHistogram::add(double seconds) {
+    double position = (std::log10(std::max(seconds, 1e-6)) + 6.0) * BUCKETS_PER_DECADE;
+    size_t bucket = std::min(buckets.size() - 1, static_cast<size_t>(std::max(0.0, position)));
+    buckets[bucket]++;
+    total++;
+    sum += seconds;
+    maximum = std::max(maximum, seconds);
+}
+
+double LatencyHistogram::quantile(double q) const {
+    if (total == 0) return 0.0;
+    size_t rank = static_cast<size_t>(q * static_cast<double>(total - 1) + 0.5);
+    size_t seen = 0;
+    for (size_t bucket = 0; bucket + 1 < buckets.size(); bucket++) {
+        seen += buckets[bucket];
+        if (seen > rank) {
+            double center = std::pow(10.0, (static_cast<double>(bucket) + 0.5) / BUCKETS_PER_DECADE - 6.0);
+            return std::min(center, maximum);
+        }
+    }
+    return maximum;
+}
+
+/**
+ * Dispatches one request line and records its latency under its command
+ */
+std::string ClusteringService::handle(const std::string& request) {
+    auto start = std::chrono::steady_clock::now();
+
+    std::istringstream in(request);
+    std::vector<std::string> args;
+    for (std::string word; in >> word;) args.push_back(word);
+    if (args.empty()) return error("requête vide");
+
+    std::string command = args[0];
+    std::transform(command.begin(), command.end(), command.begin(), ::toupper);
+
+    std::string response;
+    try {
+        if (command == "LOAD") response = load(args);
+        else if (command == "SOLVE") response = solve(args);
+        else if (command == "CURVE") response = curve(args);
+        else if (command == "DROP") response = drop(args);
+        else if (command == "LIST") response = list();
+        else if (command == "STATS") response = report();
+        else if (command == "SHUTDOWN") {
+            stopping = true;
+            response = ok({});
+        } else {
+            return error("commande inconnue " + args[0]);
+        }
+    } catch (const std::exception& e) {
+        response = error(e.what());
+    }
+
+    CommandStats& entry = stats[command];
+    entry.count++;
+    if (response.compare(0, 3, "ERR") == 0) entry.errors++;
+    entry.latencies.add(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    return response;
+}
+
+/**
+ * Reads the file once and keeps its points sorted by first coordinate
+ * (stable): the solvers built on them find their input sorted
+ */
+std::string ClusteringService::load(const std::vector<std::string>& args) {
+    size_t maxLength = 0;
+    if (args.size() < 3 || args.size() > 4 || (args.size() == 4 && !parseCount(args[3], maxLength))) {
+        return error("usage: LOAD nom fichier [L]");
+    }
+
+    MedoidsDP reader;
+    reader.import(args[2]);
+    const vector<double>& raw = reader.getPoints();
+    size_t N = reader.getNbPoints(), D = reader.getDimension();
+    if (N == 0 || D == 0) return error("aucun point dans " + args[2]);
+
+    vector<size_t> order(N);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&raw, D](size_t a, size_t b) { return raw[a * D] < raw[b * D]; });
+
+    Dataset& dataset = datasets[args[1]];
+    dataset.file = args[2];
+    dataset.N = N;
+    dataset.D = D;
+    dataset.maxLength = static_cast<uint>(maxLength);
+    dataset.solvers.clear();
+    dataset.points.resize(N * D);
+    for (size_t p = 0; p < N; p++) {
+        std::copy(raw.begin() + order[p] * D, raw.begin() + (order[p] + 1) * D, dataset.points.begin() + p * D);
+    }
+    return ok({std::to_string(N) + " " + std::to_string(D)});
+}
+
+SolverDP* ClusteringService::solverFor(const std::string& name, const std::string& criterion, size_t k, std::string& message) {
+    auto found = datasets.find(name);
+    if (found == datasets.end()) {
+        message = "jeu inconnu " + name;
+        return nullptr;
+    }
+    Dataset& dataset = found->second;
+    if (criterion != "medoids" && criterion != "median") {
+        message = "critère inconnu " + criterion + " (medoids ou median)";
+        return nullptr;
+    }
+    if (k == 0 || k > dataset.N) {
+        message = "k doit être dans [1, " + std::to_string(dataset.N) + "]";
+        return nullptr;
+    }
+
+    std::unique_ptr<SolverDP>& solver = dataset.solvers[criterion];
+    uint reusedRows = 0;
+    if (!solver) {
+        if (criterion == "medoids") solver.reset(new MedoidsDP());
+        else solver.reset(new MedianDP());
+        solver->setPoints(dataset.points.data(), dataset.N, dataset.D, dataset.D);
+        solver->setDistanceMatrixBudget(DISTANCE_MATRIX_BUDGET);
+        solver->setCostCacheCapacity(COST_CACHE_ENTRIES);
+        solver->setFillTiling(true);
+        if (dataset.maxLength > 0) solver->setClusterLengthBounds(dataset.maxLength);
+        solver->setNbClusters(k);
+        solver->solve();
+    } else if (!solver->solveForClusters(k)) {
+        message = "pas de partition en " + std::to_string(k) + " clusters admissible";
+        return nullptr;
+    } else {
+        reusedRows = solver->getReusedRows();
+    }
+
+    if (solver->getSolutionIntervals().size() != k) {
+        message = "pas de solution pour " + std::to_string(k) + " clusters";
+        solver.reset();
+        return nullptr;
+    }
+    rowsFilled += k - reusedRows;
+    rowsFromCache += reusedRows;
+    return solver.get();
+}
+
+std::string ClusteringService::solve(const std::vector<std::string>& args) {
+    size_t k;
+    if (args.size() != 4 || !parseCount(args[3], k)) return error("usage: SOLVE nom critère k");
+
+    std::string message;
+    SolverDP* solver = solverFor(args[1], args[2], k, message);
+    if (!solver) return error(message);
+
+    std::vector<std::string> lines = {"cost " + formatCost(solver->getSolutionCost())};
+    const vector<double>& points = solver->getPoints();
+    size_t D = solver->getDimension();
+    for (const auto& interval : solver->getSolutionIntervals()) {
+        std::ostringstream line;
+        line << interval.first << " " << interval.second << " " << std::setprecision(17)
+             << points[interval.first * D] << " " << points[interval.second * D];
+        lines.push_back(line.str());
+    }
+    return ok(lines);
+}
+
+std::string ClusteringService::curve(const std::vector<std::string>& args) {
+    size_t maxK;
+    if (args.size() != 4 || !parseCount(args[3], maxK)) return error("usage: CURVE nom critère kmax");
+
+    std::string message;
+    SolverDP* solver = solverFor(args[1], args[2], maxK, message);
+    if (!solver) return error(message);
+
+    vector<double> costs = solver->getCostCurve();
+    std::vector<std::string> lines;
+    for (size_t k = 1; k <= maxK && k <= costs.size(); k++) {
+        lines.push_back(std::to_string(k) + " " + formatCost(costs[k - 1]));
+    }
+    return ok(lines);
+}
+
+std::string ClusteringService::drop(const std::vector<std::string>& args) {
+    if (args.size() != 2) return error("usage: DROP nom");
+    if (datasets.erase(args[1]) == 0) return error("jeu inconnu " + args[1]);
+    return ok({});
+}
+
+// Un jeu par ligne : nom, fichier, N, D, puis lignes DP en mémoire par critère
+std::string ClusteringService::list() const {
+    std::vector<std::string> lines;
+    for (const auto& entry : datasets) {
+        std::string line = entry.first + " " + entry.second.file + " " + std::to_string(entry.second.N) + " "
+                           + std::to_string(entry.second.D);
+        for (const auto& solver : entry.second.solvers) {
+            if (solver.second) line += " " + solver.first + "=" + std::to_string(solver.second->getComputedRows());
+        }
+        lines.push_back(line);
+    }
+    return ok(lines);
+}
+
+/**
+ * Uptime, throughput, DP rows computed and served from the tables in memory,
+ * then per command: count, errors and latency (mean, median, p99, max, ms;
+ * median and p99 from the latency histogram)
+ */
+std::string ClusteringService::report() const {
+    double uptime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    size_t requests = 0;
+    for (const auto& entry : stats) requests += entry.second.count;
+
+    std::ostringstream header;
+    header << std::fixed << std::setprecision(3) << "uptime_s " << uptime << " requests " << requests
+           << " throughput_rps " << (uptime > 0.0 ? requests / uptime : 0.0)
+           << " dp_rows_filled " << rowsFilled << " dp_rows_cached " << rowsFromCache
+           << " datasets " << datasets.size();
+    std::vector<std::string> lines = {header.str()};
+
+    for (const auto& entry : stats) {
+        const LatencyHistogram& latencies = entry.second.latencies;
+        std::ostringstream line;
+        line << std::fixed << std::setprecision(3) << entry.first << " count " << entry.second.count
+             << " errors " << entry.second.errors
+             << " mean_ms " << 1000.0 * latencies.mean()
+             << " p50_ms " << 1000.0 * latencies.quantile(0.5)
+             << " p99_ms " << 1000.0 * latencies.quantile(0.99)
+             << " max_ms " << 1000.0 * latencies.max();
+        lines.push_back(line.str());
+    }
+    return ok(lines);
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <chrono>
+#include <array>
+#include <cstddef>
+#include "solverDP.hpp"
+
+// Histogramme des latences à classes logarithmiques (16 par décade, de 1 µs à 1000 s) : mémoire
+// fixe quel que soit le nombre de requêtes, quantiles à la précision d'une classe (~15 %)
+class LatencyHistogram {
+public:
+    LatencyHistogram() : buckets{}, total(0), sum(0.0), maximum(0.0) {}
+
+    void add(double seconds);
+    size_t count() const { return total; }
+    double mean() const { return total > 0 ? sum / static_cast<double>(total) : 0.0; }
+    double max() const { return maximum; }
+    // Centre géométrique de la classe contenant le quantile q (max() pour la dernière classe)
+    double quantile(double q) const;
+
+private:
+    static const size_t BUCKETS_PER_DECADE = 16;
+    static const size_t DECADES = 9;  // 1e-6 s .. 1e3 s
+    std::array<size_t, BUCKETS_PER_DECADE * DECADES + 1> buckets;
+    size_t total;
+    double sum;
+    double maximum;
+};
+
+/**
+ * Service de clustering : garde en mémoire les jeux de points chargés (triés une
+ * fois par première coordonnée) et, par critère, un solveur DP dont la table, la
+ * bande de coûts d'intervalle, les distances et le cache des coûts sont conservés
+ * entre les requêtes. Une requête pour k clusters ne remplit que les lignes DP qui
+ * manquent (SolverDP::solveForClusters). Une requête est une ligne de texte, la
+ * réponse une ligne "OK n" suivie de n lignes, ou "ERR message".
+ *
+ *   LOAD nom fichier [L]        charge (ou recharge) un jeu de points, L : taille maximale de cluster
+ *   SOLVE nom critère k         intervalles "premier dernier xmin xmax" (positions triées), critère medoids|median
+ *   CURVE nom critère kmax      coût optimal pour k = 1..kmax
+ *   DROP nom | LIST | STATS | SHUTDOWN
+ */
+class ClusteringService {
+public:
+    ClusteringService() : stopping(false), startTime(std::chrono::steady_clock::now()),
+                          rowsFilled(0), rowsFromCache(0) {}
+
+    std::string handle(const std::string& request);
+    bool isStopping() const { return stopping; }
+
+private:
+    struct Dataset {
+        std::string file;
+        std::vector<double> points;   // Triés par première coordonnée (tri stable)
+        size_t N;
+        size_t D;
+        uint maxLength;               // 0 : non borné
+        std::map<std::string, std::unique_ptr<SolverDP>> solvers;  // Par critère, créés à la première requête
+    };
+
+    struct CommandStats {
+        size_t count;
+        size_t errors;
+        LatencyHistogram latencies;
+    };
+
+    std::map<std::string, Dataset> datasets;
+    std::map<std::string, CommandStats> stats;
+    bool stopping;
+    std::chrono::steady_clock::time_point startTime;
+    size_t rowsFilled;      // Lignes DP calculées par les requêtes
+    size_t rowsFromCache;   // Lignes DP demandées et déjà présentes
+
+    std::string load(const std::vector<std::string>& args);
+    std::string solve(const std::vector<std::string>& args);
+    std::string curve(const std::vector<std::string>& args);
+    std::string drop(const std::vector<std::string>& args);
+    std::string list() const;
+    std::string report() const;
+
+    // Solveur du critère sur le jeu, résolu pour k clusters ; nullptr et message dans error en cas d'échec
+    SolverDP* solverFor(const std::string& name, const std::string& criterion, size_t k, std::string& error);
+};
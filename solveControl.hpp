@@ -0,0 +1,42 @@
+#pragma once
+#include <atomic>
+#include <functional>
+
+/**
+ * Contrôle d'un solve borné dans le temps : jeton d'annulation partagé entre
+ * l'appelant et le remplissage (une lecture atomique relâchée par case), avancement
+ * après chaque ligne DP et bilan du solve.
+ */
+class CancellationToken {
+public:
+    CancellationToken() : cancelled(false) {}
+
+    void cancel() { cancelled.store(true, std::memory_order_relaxed); }
+    void reset() { cancelled.store(false, std::memory_order_relaxed); }
+    bool isCancelled() const { return cancelled.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<bool> cancelled;
+};
+
+// Avancement après une ligne DP ; le temps restant est estimé au débit de cases mesuré
+struct SolveProgress {
+    unsigned rowsCompleted;
+    unsigned totalRows;
+    double elapsedSeconds;
+    double remainingSeconds;
+};
+
+// Appelé par le thread qui termine la ligne, hors de toute région parallèle de cases
+typedef std::function<void(const SolveProgress&)> ProgressCallback;
+
+// Bilan du dernier solve : une solution non optimale est la meilleure solution de repli à K clusters
+struct SolveOutcome {
+    bool optimal;
+    bool cancelled;
+    bool deadlineExpired;
+    unsigned rowsCompleted;     // Lignes DP complètes à l'arrêt
+    unsigned fallbackClusters;  // Solution optimale à moins de clusters redécoupée (0 : découpage régulier)
+    bool exactCost;             // Faux : coût du repli estimé (minorants des sommes préfixes, ou bande en float)
+    double seconds;
+};
@@ -1,17 +1,40 @@
 #include "solver.hpp"
 #include <iostream>
 #include <stdexcept>
+#include <algorithm>
+#include <cstdint>
 
 void Solver::import(const std::string& filename) {
     points.clear();
     solution.clear();
     isSorted = false;
 
-    std::ifstream file(filename);
+    std::ifstream file(filename, std::ios::binary);
     if (!file.is_open()) {
         throw std::runtime_error("File not found: " + filename);
     }
 
+    // Fichier binaire : en-tête puis les coordonnées d'un seul bloc
+    char magic[sizeof(POINTS_BINARY_MAGIC) - 1];
+    if (file.read(magic, sizeof(magic)) && std::equal(magic, magic + sizeof(magic), POINTS_BINARY_MAGIC)) {
+        uint64_t header[2];
+        file.read(reinterpret_cast<char*>(header), sizeof(header));
+        N = static_cast<size_t>(header[0]);
+        D = static_cast<size_t>(header[1]);
+        trace() << "Number of points: " << N << std::endl;
+        trace() << "Dimension: " << D << std::endl;
+
+        points.resize(N * D);
+        if (!file || !file.read(reinterpret_cast<char*>(points.data()), static_cast<std::streamsize>(N * D * sizeof(double)))) {
+            points.clear();
+            throw std::runtime_error("Insufficient data in file");
+        }
+        solution.resize(N, 0);
+        return;
+    }
+    file.clear();
+    file.seekg(0);
+
     double tmpValue;
     file >> tmpValue;
     N = static_cast<size_t>(tmpValue);
@@ -19,8 +42,8 @@ void Solver::import(const std::string& filename) {
     file >> tmpValue;
     D = static_cast<size_t>(tmpValue);
 
-    std::cout << "Number of points: " << N << std::endl;
-    std::cout << "Dimension: " << D << std::endl;
+    trace() << "Number of points: " << N << std::endl;
+    trace() << "Dimension: " << D << std::endl;
 
     points.reserve(N * D);
 
@@ -37,6 +60,20 @@ void Solver::import(const std::string& filename) {
     solution.resize(N, 0);
 }
 
+void Solver::setPoints(const double* data, size_t numPoints, size_t dimension, size_t stride, const size_t* order) {
+    N = numPoints;
+    D = dimension;
+    isSorted = false;
+
+    points.resize(N * D);
+    for (size_t i = 0; i < N; i++) {
+        const double* source = data + (order ? order[i] : i) * stride;
+        std::copy(source, source + D, points.begin() + i * D);
+    }
+
+    solution.assign(N, 0);
+}
+
 void Solver::displaySolution() const {
     std::cout << "\nClustering solution with " << K << " clusters (total cost: " << solutionCost << "):" << std::endl;
 
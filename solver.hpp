@@ -7,6 +7,9 @@
 
 using namespace std;
 
+// En-tête des fichiers de points binaires : ces 8 octets, N et D (uint64), puis N * D doubles (ordre de la machine)
+const char POINTS_BINARY_MAGIC[] = "CLPOINTS";
+
 class Solver {
 protected:
     size_t D; // Dimension
@@ -16,6 +19,13 @@ protected:
     vector<size_t> solution; // Affectation des clusters
     double solutionCost;
     bool isSorted;
+    std::ostream* logStream; // Traces du solveur, nullptr : coupées
+
+    // Flux des traces : logStream, ou un flux sans tampon (propre au thread) qui n'écrit rien
+    std::ostream& trace() const {
+        thread_local std::ostream silent(nullptr);
+        return logStream ? *logStream : silent;
+    }
 
     void displayPoint(size_t index) const {
         std::cout << "( ";
@@ -40,7 +50,7 @@ protected:
     }
 
 public:
-    Solver() : D(0), K(0), N(0), solutionCost(0.0), isSorted(false) {}
+    Solver() : D(0), K(0), N(0), solutionCost(0.0), isSorted(false), logStream(&std::cout) {}
     virtual ~Solver() = default;
 
     virtual void solve() = 0;
@@ -52,10 +62,19 @@ public:
 
     void setNbClusters() {
         K = std::max(3u, static_cast<unsigned int>(std::sqrt(N)));
-        std::cout << "Nombre de clusters défini à: " << K << std::endl;
+        trace() << "Nombre de clusters défini à: " << K << std::endl;
     }
 
+    void setNbClusters(size_t k) { K = k; }
+    // Traces de solve (std::cout par défaut) ; nullptr les coupe pour ce solveur seulement, sans toucher à std::cout
+    void setLogStream(std::ostream* stream) { logStream = stream; }
+
+    // Fichier texte ("N D" puis les coordonnées) ou binaire (POINTS_BINARY_MAGIC)
     void import(const string& filename);
+    // Copie les points d'un tampon de l'appelant (point i à data[i * stride], stride >= dimension),
+    // dans l'ordre order[0..N-1] s'il est fourni ; le tampon n'est pas conservé
+    void setPoints(const double* data, size_t numPoints, size_t dimension, size_t stride,
+                   const size_t* order = nullptr);
     void displaySolution() const;
 
     const std::vector<double>& getPoints() const { return points; }
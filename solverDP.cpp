@@ -1,75 +1,1373 @@
 #include "solverDP.hpp"
+#include "splitKernels.hpp"
+#include "solverPool.hpp"
 #include <iostream>
 #include <limits>
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <unistd.h>
 #ifdef _OPENMP
 #include <omp.h>
 #endif
 
+namespace {
+
+// Ordonnancement des boucles schedule(runtime) du remplissage pendant un solve :
+// statique en premier accès (mêmes threads que l'initialisation), dynamique sinon
+class FillSchedule {
+public:
+    explicit FillSchedule(bool firstTouch) {
+#ifdef _OPENMP
+        omp_get_schedule(&previousKind, &previousChunk);
+        omp_set_schedule(firstTouch ? omp_sched_static : omp_sched_dynamic, firstTouch ? 0 : 1);
+#else
+        (void)firstTouch;
+#endif
+    }
+
+    ~FillSchedule() {
+#ifdef _OPENMP
+        omp_set_schedule(previousKind, previousChunk);
+#endif
+    }
+
+private:
+#ifdef _OPENMP
+    omp_sched_t previousKind;
+    int previousChunk;
+#endif
+};
+
+}
+
 void SolverDP::solve() {
+    clusterSolutions.clear();
     if (!validateInputs()) return;
 
 #ifdef _OPENMP
-    std::cout << "OpenMP disponible avec " << omp_get_max_threads() << " threads" << std::endl;
+    trace() << "OpenMP disponible avec " << omp_get_max_threads() << " threads" << std::endl;
 #endif
 
+    FillSchedule schedule(memoryPolicy.placement == MemoryPlacement::FIRST_TOUCH);
+    firstFillColumn = 0;
+
     resort(); // Trier les points
-    initializeMatrix();
+    if (!reducePoints()) return;
+    applyPointsPolicy();
+    if (mixedPrecision) {
+        pointsFloat.assign(points.begin(), points.end());
+    }
+    prepareDistanceMatrix();
+    costCache.configure(costCacheEntries);
+
+    outOfCore = memoryBudget > 0 && estimateFootprint() > memoryBudget;
+    if (outOfCore) initializeRowRing();
+    else initializeMatrix();
+
+    bool warm = warmStart && !outOfCore && !mixedPrecision;
+    if (warm) {
+        computePrefixSums();
+        if (!costCache.isEnabled()) costCache.configure(static_cast<size_t>(N) * (4 * warmWindow + 2));
+    }
 
-    vector<double> v(N, 0.0);
+    // En mode borné, les vecteurs de coûts ne couvrent que les L tailles admissibles
+    // (en démarrage à chaud, les coûts sont évalués à la demande)
+    vector<double> v(getMaxClusterLength(), 0.0);
+    bandComplete = false;
+    if (isLengthBounded() && !warm) fillBandCosts();
+
+    auto fillStart = beginFill();
     fillFirstLine(v);
+    firstFillRow = 1;
+    firstFillColumn = 0;
+    resumedRows = 0;
+    if (!resumePath.empty() && !restoreCheckpoint()) {
+        endFill(fillStart);
+        restoreFullPoints();
+        return;
+    }
+    startCheckpoint();
+
+    fillStartTime = fillStart;
+    // Première ligne interrompue (échéance pendant ses coûts) : aucune ligne complète
+    rowsCompleted = fillStopped() ? 0 : firstFillRow;
+    stopFill.store(anytime && (fillStopped() || fillStart >= deadline));
+    outcome = SolveOutcome{true, false, false, 0, 0, true, 0.0};
+
+    if (outOfCore) fillDPMatrixOutOfCore(v);
+    else if (warm) fillDPMatrixWarm(v.size());
+    else fillDPMatrix(v);
+    checkpoint.close();
+    endFill(fillStart);
+    trace() << "Remplissage DP: " << fillSeconds << " s" << std::endl;
+
+    if (anytime && rowsCompleted < K) {
+        buildFallbackSolution();
+    } else {
+        rowsCompleted = K;
+        if (outOfCore) buildSolutionFromSpill();
+        else buildSolutionFromMatrix(K - 1);
+    }
+    computeSolutionFromIntervals();
+    computeIntervalCenters();
+    if (outcome.optimal) {
+        calculateFinalCost();
+        if (mixedPrecision) recheckSolutionCost();
+    }
+    spill.close();
+    expandReducedSolution();
+    outcome.rowsCompleted = rowsCompleted;
+
+    if (costCache.isEnabled()) {
+        IntervalCostCache::Stats stats = costCache.getStats();
+        trace() << "Cache des coûts: " << stats.hits << " hits, " << stats.misses << " miss (taux "
+                  << 100.0 * stats.hitRate() << "%), " << stats.evictions << " évictions, capacité "
+                  << stats.capacity << std::endl;
+    }
+    trace() << "Mémoire (" << memoryPolicy.describe() << "): table DP " << matrixDP.getAllocation().describe()
+              << ", points " << pointsAllocation.describe() << std::endl;
+}
+
+/**
+ * Updates the previous solution after inserting and removing points. The sorted
+ * order is kept for the unchanged points and inserted points are merged after
+ * the existing ones with the same first coordinate, so the first p = min(first
+ * removed index, first insertion position) points are untouched. A DP cell
+ * (k, n) only depends on points 0..n, hence columns [0, p) of every row, and the
+ * rows [0, p) of the cost band, are reused; only columns >= p are recomputed.
+ * Falls back to a full solve when no in-memory table is available
+ *
+ * @param insertedPoints Flat coordinates of the new points (multiple of D)
+ * @param removedIndices Indices, in the current sorted order, of the points to remove
+ * @return false if the update is invalid (nothing changed)
+ */
+bool SolverDP::update(const vector<double>& insertedPoints, const vector<size_t>& removedIndices) {
+    if (!genericFillAvailable("update")) return false;
+    if (D == 0 || insertedPoints.size() % D != 0) {
+        std::cerr << "Erreur: coordonnées insérées incomplètes (dimension " << D << ")" << std::endl;
+        return false;
+    }
+    vector<size_t> removed(removedIndices);
+    std::sort(removed.begin(), removed.end());
+    removed.erase(std::unique(removed.begin(), removed.end()), removed.end());
+    if (!removed.empty() && removed.back() >= N) {
+        std::cerr << "Erreur: indice supprimé " << removed.back() << " hors de [0, " << N << ")" << std::endl;
+        return false;
+    }
+
+    size_t numInserted = insertedPoints.size() / D;
+    vector<size_t> order(numInserted);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return insertedPoints[a * D] < insertedPoints[b * D];
+    });
+
+    // Avec la réduction, les colonnes de la table ne correspondent plus aux points triés
+    bool reusable = isMatrixAvailable() && matrixDP.getRows() == K && matrixDP.getCols() == N && isSorted
+                    && !removeDominated && !collapseDuplicates;
+
+    // Validation pour le nouveau nombre de points avant toute modification : un refus laisse le solveur intact
+    size_t oldN = N;
+    size_t newN = N - removed.size() + numInserted;
+    N = newN;
+    bool valid = validateInputs();
+    N = oldN;
+    if (!valid) return false;
+
+    // Fusion : points conservés dans leur ordre, insertions après les égaux
+    vector<double> merged;
+    merged.reserve(newN * D);
+    size_t firstChanged = newN;
+    size_t r = 0, q = 0;
+    for (size_t i = 0; i <= N; i++) {
+        while (q < numInserted && (i == N || insertedPoints[order[q] * D] < getCoordinate(i, 0))) {
+            firstChanged = std::min(firstChanged, merged.size() / D);
+            merged.insert(merged.end(), insertedPoints.begin() + order[q] * D, insertedPoints.begin() + (order[q] + 1) * D);
+            q++;
+        }
+        if (i == N) break;
+        if (r < removed.size() && removed[r] == i) {
+            firstChanged = std::min(firstChanged, merged.size() / D);
+            r++;
+            continue;
+        }
+        merged.insert(merged.end(), points.begin() + i * D, points.begin() + (i + 1) * D);
+    }
+
+    points = std::move(merged);
+    N = newN;
+    solution.assign(N, 0);
+
+    updateStats = UpdateStats{firstChanged, 0, fullSolveCells()};
+    if (!reusable || outOfCore) {
+        solve();
+        updateStats.firstChanged = 0;
+        updateStats.recomputedCells = updateStats.fullCells;
+        return true;
+    }
+
+    FillSchedule schedule(memoryPolicy.placement == MemoryPlacement::FIRST_TOUCH);
+    uint p = static_cast<uint>(std::min(firstChanged, oldN));
+    firstFillColumn = p;
+
+    applyPointsPolicy();
+    if (mixedPrecision) {
+        pointsFloat.assign(points.begin(), points.end());
+    }
+    prepareDistanceMatrix();
+    costCache.configure(costCacheEntries); // Clés (début, fin) décalées : cache vidé
+
+    MatrixDouble previous = std::move(matrixDP);
+    initializeMatrix();
+    for (size_t k = 0; k < K; k++) {
+        std::copy(previous.getRow(k), previous.getRow(k) + p, matrixDP.getRow(k));
+    }
+
+    vector<double> v(getMaxClusterLength(), 0.0);
+    if (isLengthBounded()) {
+        MatrixDouble previousBand = std::move(bandCosts);
+        fillBandCosts();
+        for (uint n = 0; n < p && n < previousBand.getRows(); n++) {
+            std::copy(previousBand.getRow(n), previousBand.getRow(n) + previousBand.getCols(), bandCosts.getRow(n));
+        }
+    }
+
+    auto fillStart = beginFill();
+    uint L = getMaxClusterLength();
+#pragma omp parallel for if(N > 50) schedule(dynamic)
+    for (uint n = std::max(p, minClusterLength - 1); n < L; n++) {
+        matrixDP.setElement(0, n, clusterCost(0, n));
+    }
+    firstFillRow = 1;
     fillDPMatrix(v);
-    buildSolutionFromMatrix();
+    endFill(fillStart);
+
+    buildSolutionFromMatrix(K - 1);
+    computeSolutionFromIntervals();
+    computeIntervalCenters();
+    calculateFinalCost();
+    if (mixedPrecision) recheckSolutionCost();
+    firstFillColumn = 0;
+
+    for (size_t k = 0; k < K; k++) {
+        updateStats.recomputedCells += N - std::max<size_t>(k, p);
+    }
+    trace() << "Mise à jour incrémentale: " << numInserted << " insertions, " << removed.size()
+              << " suppressions, colonnes >= " << p << " recalculées (" << updateStats.recomputedCells << " cases sur "
+              << updateStats.fullCells << "), " << fillSeconds << " s" << std::endl;
+    return true;
+}
+
+/**
+ * Solves for k clusters on the points of the previous solve. Cell (r, n) is
+ * the optimal cost of r + 1 clusters over points 0..n whatever K, so the
+ * rows already in the table are kept: k <= computed rows only backtracks
+ * from row k - 1, a larger k reallocates the table and fills rows from the
+ * first missing one with the cost band, distances and cost cache of the
+ * previous solve. The solution of each k is kept until the next fill, so a
+ * repeated k only relabels the points. Falls back to a full solve when no
+ * in-memory table is available for these points
+ *
+ * @return false if k clusters are not admissible (nothing changed)
+ */
+bool SolverDP::solveForClusters(size_t k) {
+    if (!genericFillAvailable("solveForClusters")) return false;
+    size_t previousK = K;
+    K = k;
+    if (!validateInputs()) {
+        K = previousK;
+        return false;
+    }
+
+    bool reusable = getComputedRows() > 0 && isSorted && fullPoints.empty() && !removeDominated && !collapseDuplicates
+                    && (!isLengthBounded() || bandCosts.getRows() == N);
+    if (!reusable) {
+        reusedRows = 0;
+        solve();
+        return true;
+    }
+
+    uint rows = getComputedRows();
+    reusedRows = std::min(static_cast<uint>(K), rows);
+    fillSeconds = 0.0;
+    if (K > rows) {
+        FillSchedule schedule(memoryPolicy.placement == MemoryPlacement::FIRST_TOUCH);
+        MatrixDouble previous = std::move(matrixDP);
+        initializeMatrix();
+        for (uint r = 0; r < rows; r++) {
+            std::copy(previous.getRow(r), previous.getRow(r) + N, matrixDP.getRow(r));
+        }
+
+        vector<double> v(getMaxClusterLength(), 0.0);
+        auto fillStart = beginFill();
+        firstFillRow = rows;
+        firstFillColumn = 0;
+        fillDPMatrix(v);
+        firstFillRow = 1;
+        endFill(fillStart);
+        trace() << "Lignes DP " << rows << " à " << K - 1 << " remplies en " << fillSeconds << " s" << std::endl;
+    }
+
+    auto cached = clusterSolutions.find(K);
+    if (cached != clusterSolutions.end()) {
+        solutionInterval = cached->second.intervals;
+        intervalCenters = cached->second.centers;
+        solutionCost = cached->second.cost;
+        computeSolutionFromIntervals();
+        return true;
+    }
+
+    buildSolutionFromMatrix(K - 1);
     computeSolutionFromIntervals();
+    computeIntervalCenters();
     calculateFinalCost();
+    if (mixedPrecision) recheckSolutionCost();
+    clusterSolutions[K] = ClusterSolution{solutionInterval, intervalCenters, solutionCost};
+    return true;
+}
+
+vector<double> SolverDP::getCostCurve() const {
+    vector<double> curve;
+    for (uint r = 0; r < getComputedRows(); r++) curve.push_back(matrixDP.getElement(r, N - 1));
+    return curve;
+}
+
+void SolverDP::setPointReduction(bool removeDominatedPoints, bool collapseDuplicatePoints) {
+    removeDominated = removeDominatedPoints;
+    collapseDuplicates = collapseDuplicatePoints;
+}
+
+/**
+ * Reduces the sorted points before the DP. The points are ordered
+ * lexicographically (O(N log N)), so exact duplicates are adjacent and become
+ * one point weighted by their count. For a 2D front with both objectives
+ * minimized, a sweep in that order keeps a point only if its second
+ * coordinate is strictly below every point kept so far: any other point has
+ * a kept point with a smaller or equal first coordinate and a smaller or equal
+ * second one, hence is dominated. The reduced points stay sorted by their
+ * first coordinate; the full set is kept to map the labels back
+ *
+ * @return false if the reduced set cannot be partitioned (the solve is abandoned)
+ */
+bool SolverDP::reducePoints() {
+    weights.clear();
+    fullPoints.clear();
+    reducedIndex.clear();
+    reductionStats = ReductionStats{N, 0, 0, N};
+    if (!removeDominated && !collapseDuplicates) return true;
+
+    bool filter = removeDominated;
+    if (filter && D != 2) {
+        trace() << "Réduction: filtre de dominance ignoré (dimension " << D << " au lieu de 2)" << std::endl;
+        filter = false;
+    }
+
+    vector<size_t> order(N);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        for (size_t dim = 0; dim < D; dim++) {
+            if (getCoordinate(a, dim) != getCoordinate(b, dim)) return getCoordinate(a, dim) < getCoordinate(b, dim);
+        }
+        return a < b;
+    });
+
+    auto samePoint = [this](size_t a, size_t b) {
+        for (size_t dim = 0; dim < D; dim++) {
+            if (getCoordinate(a, dim) != getCoordinate(b, dim)) return false;
+        }
+        return true;
+    };
+
+    const size_t npos = std::numeric_limits<size_t>::max();
+    vector<size_t> mapping(N, npos);
+    vector<double> reduced;
+    vector<double> counts;
+    size_t lastKept = npos;
+    double bestSecond = std::numeric_limits<double>::infinity();
+
+    for (size_t r = 0; r < N; r++) {
+        size_t i = order[r];
+        bool duplicate = lastKept != npos && samePoint(i, lastKept);
+
+        if (duplicate && collapseDuplicates) {
+            mapping[i] = mapping[lastKept];
+            counts.back() += 1.0;
+            reductionStats.duplicates++;
+            continue;
+        }
+        if (filter && !duplicate && getCoordinate(i, 1) >= bestSecond) {
+            reductionStats.dominated++;
+            continue;
+        }
+
+        mapping[i] = counts.size();
+        reduced.insert(reduced.end(), points.begin() + i * D, points.begin() + (i + 1) * D);
+        counts.push_back(1.0);
+        lastKept = i;
+        if (filter) bestSecond = getCoordinate(i, 1);
+    }
+
+    size_t reducedN = counts.size();
+    reductionStats.reducedPoints = reducedN;
+    trace() << "Réduction: " << N << " points -> " << reducedN << " (" << reductionStats.dominated
+              << " dominés, " << reductionStats.duplicates << " doublons regroupés)" << std::endl;
+    if (reducedN == N) return true;
+
+    fullPoints = std::move(points);
+    reducedIndex = std::move(mapping);
+    points = std::move(reduced);
+    N = reducedN;
+    solution.assign(N, 0);
+    if (reductionStats.duplicates > 0) weights = std::move(counts);
+
+    if (!validateInputs()) {
+        std::cerr << "Erreur: ensemble réduit à " << N << " points, résolution abandonnée" << std::endl;
+        restoreFullPoints();
+        return false;
+    }
+    return true;
+}
+
+void SolverDP::restoreFullPoints() {
+    if (fullPoints.empty()) return;
+
+    points = std::move(fullPoints);
+    N = points.size() / D;
+    solution.assign(N, 0);
+    fullPoints.clear();
+    reducedIndex.clear();
+    weights.clear();
+}
+
+/**
+ * Maps the solution of the reduced set back to every original point: a
+ * collapsed duplicate takes the label of its representative, a dominated
+ * point the label of the interval whose slice of the first coordinate holds
+ * it (AssignmentIndex::assignToSlice, without the medoid check). Labels are non-decreasing along the first
+ * coordinate, so a stable sort by label keeps the points sorted and every
+ * cluster an interval of the full sorted order. The solution cost stays the
+ * weighted cost of the reduced set: dominated points do not contribute
+ */
+void SolverDP::expandReducedSolution() {
+    if (fullPoints.empty()) return;
+
+    const size_t npos = std::numeric_limits<size_t>::max();
+    size_t fullN = fullPoints.size() / D;
+    AssignmentIndex cuts = buildAssignmentIndex();
+
+    vector<size_t> labels(fullN);
+    for (size_t i = 0; i < fullN; i++) {
+        labels[i] = reducedIndex[i] != npos ? solution[reducedIndex[i]] : cuts.assignToSlice(&fullPoints[i * D]);
+    }
+
+    vector<size_t> order(fullN);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&labels](size_t a, size_t b) {
+        return labels[a] < labels[b];
+    });
+
+    // Centre de chaque cluster : première occurrence de son point réduit dans le nouvel ordre
+    vector<size_t> position(N, npos);
+    points.assign(fullN * D, 0.0);
+    solution.assign(fullN, 0);
+    for (size_t p = 0; p < fullN; p++) {
+        size_t i = order[p];
+        std::copy(fullPoints.begin() + i * D, fullPoints.begin() + (i + 1) * D, points.begin() + p * D);
+        solution[p] = labels[i];
+        if (reducedIndex[i] != npos && position[reducedIndex[i]] == npos) position[reducedIndex[i]] = p;
+    }
+    for (size_t& center : intervalCenters) center = position[center];
+
+    N = fullN;
+    solutionInterval.assign(solutionInterval.size(), make_pair(static_cast<uint>(N), 0u));
+    for (size_t p = 0; p < N; p++) {
+        pair<uint, uint>& interval = solutionInterval[solution[p] - 1];
+        interval.first = std::min(interval.first, static_cast<uint>(p));
+        interval.second = std::max(interval.second, static_cast<uint>(p));
+    }
+
+    fullPoints.clear();
+    reducedIndex.clear();
+    weights.clear();
+}
+
+void SolverDP::setWarmStart(const vector<pair<uint, uint>>& previousIntervals, size_t previousN, uint window) {
+    warmLengths.clear();
+    for (const auto& interval : previousIntervals) {
+        warmLengths.push_back(static_cast<double>(interval.second - interval.first + 1) / std::max<size_t>(1, previousN));
+    }
+    warmWindow = window;
+    warmStart = !warmLengths.empty();
+}
+
+// Taille attendue du cluster k (dernier cluster des cases de la ligne k), mise à l'échelle de N et de K
+uint SolverDP::expectedLastClusterLength(uint k) const {
+    size_t previous = std::min(warmLengths.size() - 1, static_cast<size_t>(k) * warmLengths.size() / K);
+    double length = warmLengths[previous] * N * warmLengths.size() / K;
+    return std::max(1u, static_cast<uint>(std::lround(length)));
+}
+
+void SolverDP::computePrefixSums() {
+    prefixSums.assign((N + 1) * D, 0.0);
+    prefixSquares.assign(N + 1, 0.0);
+    prefixAbsFirst.assign(N + 1, 0.0);
+    prefixWeights.assign(N + 1, 0.0);
+    for (size_t i = 0; i < N; i++) {
+        double weight = pointWeight(i);
+        prefixWeights[i + 1] = prefixWeights[i] + weight;
+        prefixAbsFirst[i + 1] = prefixAbsFirst[i] + std::fabs(getCoordinate(i, 0));
+        double norm = 0.0;
+        for (size_t dim = 0; dim < D; dim++) {
+            double x = getCoordinate(i, dim);
+            prefixSums[(i + 1) * D + dim] = prefixSums[i * D + dim] + weight * x;
+            norm += x * x;
+        }
+        prefixSquares[i + 1] = prefixSquares[i] + weight * norm;
+    }
+}
+
+/**
+ * Lower bound of the cost of cluster [start, end] in O(D) from the prefix sums.
+ * The sum of squared distances to any point c of the cluster is SSE + n|mean - c|²,
+ * so the centroid SSE bounds the k-medoids cost. The sum of distances is at
+ * least the square root of the sum of squared distances, and at least the 1D
+ * median cost of the first coordinates (sorted, hence upper half minus lower
+ * half), so the larger of the two bounds the p-median cost. Both are lowered
+ * by a margin covering the cancellation of prefix sum differences, so that
+ * the bound stays valid. With weighted points the sums are weighted; every
+ * weight is at least 1, so the square root bound still holds, but the 1D
+ * median term (which counts points) is dropped
+ */
+double SolverDP::clusterCostLowerBound(uint start, uint end) const {
+    if (start >= end) return 0.0;
+
+    double count = prefixWeights[end + 1] - prefixWeights[start];
+    double squares = prefixSquares[end + 1] - prefixSquares[start];
+    double centroidNorm = 0.0;
+    for (size_t dim = 0; dim < D; dim++) {
+        double sum = prefixSums[(end + 1) * D + dim] - prefixSums[start * D + dim];
+        centroidNorm += sum * sum;
+    }
+    double sse = squares - centroidNorm / count;
+    sse -= 1e-12 * (prefixSquares[end + 1] + prefixSquares[start]);
+    sse = std::max(0.0, sse);
+    if (usesSquaredDistance()) return sse;
+    if (!weights.empty()) return std::sqrt(sse);
+
+    uint half = (end - start + 1) / 2;
+    const double* first = prefixSums.data(); // Coordonnée 0 du préfixe i en first[i * D]
+    double lower = first[(start + half) * D] - first[start * D];
+    double upper = first[(end + 1) * D] - first[(end + 1 - half) * D];
+    double median = upper - lower - 4e-12 * prefixAbsFirst[end + 1];
+    return std::max(std::sqrt(sse), median);
+}
+
+/**
+ * Warm-started fill. For each cell (k, n), the exact costs are evaluated only
+ * for the splits within warmWindow of n - expected length of cluster k. The
+ * other admissible splits are certified by blocks: a segment tree holds the
+ * minimum of row k-1 over aligned blocks of splits, and every split s <= b of
+ * a block ending at b satisfies
+ *     dp[k-1][s] + cost(s+1, n) >= min(dp[k-1][block]) + lowerBound(b+1, n)
+ * since cluster [s+1, n] contains [b+1, n] and the bound is a bound of its
+ * subsets. A block is dropped when this bound excludes it (bound > best on the
+ * left, where s would win a tie, bound >= best on the right) and split into
+ * its halves otherwise, down to single splits whose exact cost is evaluated.
+ * Blocks are visited left to right and the best value only decreases, so the
+ * dropped blocks stay excluded: every cell is exact, with the same
+ * smallest-split tie-break as the full scan. When the bound is tight, a cell
+ * costs O(D log N) bound checks instead of one per split
+ *
+ * @param costLength Maximum cluster length (N, or L in bounded mode)
+ */
+void SolverDP::fillDPMatrixWarm(size_t costLength) {
+    warmStats = WarmStartStats{0, 0, 0, 0, 0, 0};
+    const double sentinel = std::numeric_limits<double>::max();
+    size_t windowCosts = 0, boundChecks = 0, widenedCosts = 0, widenedCells = 0, cells = 0, fullCosts = 0;
+
+    // Minimum de la ligne précédente par bloc aligné de splits (arbre de segments, feuille s en leaves + s)
+    uint leaves = 1;
+    while (leaves < N) leaves <<= 1;
+    vector<double> rowMinima(2 * static_cast<size_t>(leaves), sentinel);
+
+    for (uint k = firstFillRow; k < K && !fillStopped(); k++) {
+        const double* previousRow = matrixDP.getRow(k-1);
+        double* currentRow = matrixDP.getRow(k);
+        uint length = expectedLastClusterLength(k);
+        bool useParallel = (N > 50);
+        for (uint s = 0; s < N; s++) rowMinima[leaves + s] = previousRow[s];
+        for (size_t node = leaves - 1; node > 0; node--) {
+            rowMinima[node] = std::min(rowMinima[2 * node], rowMinima[2 * node + 1]);
+        }
+
+#pragma omp parallel for if(useParallel) schedule(runtime) \
+        reduction(+:windowCosts, boundChecks, widenedCosts, widenedCells, cells, fullCosts)
+        for (uint n = std::max(k, firstFillColumn); n < N; n++) {
+            uint first, end;
+            if (fillInterrupted(n) || !splitWindow(k, n, costLength, first, end)) continue;
+            cells++;
+            fullCosts += end - first;
+
+            // Fenêtre autour du split attendu, réduite aux splits admissibles et non vide
+            long expected = static_cast<long>(n) - static_cast<long>(length);
+            uint lo = static_cast<uint>(std::min<long>(std::max<long>(expected - warmWindow, first), end - 1));
+            uint hi = static_cast<uint>(std::max<long>(std::min<long>(expected + warmWindow + 1, end), lo + 1));
+
+            double best = sentinel;
+            uint bestSplit = lo;
+            for (uint s = lo; s < hi; s++) {
+                if (previousRow[s] == sentinel) continue;
+                double cost = previousRow[s] + clusterCost(s + 1, n);
+                windowCosts++;
+                if (cost < best) {
+                    best = cost;
+                    bestSplit = s;
+                }
+            }
+
+            // Certificat hors fenêtre par blocs, découpés là où la borne ne suffit pas
+            bool widened = false;
+            auto certify = [&](uint from, uint to, bool left) {
+                struct Block { size_t node; uint lo, hi; };
+                Block stack[2 * 33];
+                int top = 0;
+                stack[top++] = Block{1, 0, leaves};
+                while (top > 0) {
+                    Block block = stack[--top];
+                    uint lo = std::max(block.lo, from), hi = std::min(block.hi, to);
+                    if (lo >= hi) continue;
+                    if (lo == block.lo && hi == block.hi) {
+                        boundChecks++;
+                        double bound = rowMinima[block.node] + clusterCostLowerBound(hi, n);
+                        if (left ? bound > best : bound >= best) continue;
+                        if (hi - lo == 1) {
+                            if (previousRow[lo] == sentinel) continue;
+                            double cost = previousRow[lo] + clusterCost(lo + 1, n);
+                            widenedCosts++;
+                            widened = true;
+                            if (cost < best || (cost == best && lo < bestSplit)) {
+                                best = cost;
+                                bestSplit = lo;
+                            }
+                            continue;
+                        }
+                    }
+                    uint middle = block.lo + (block.hi - block.lo) / 2;
+                    stack[top++] = Block{2 * block.node + 1, middle, block.hi};
+                    stack[top++] = Block{2 * block.node, block.lo, middle};
+                }
+            };
+            certify(first, lo, true);
+            certify(hi, end, false);
+            if (widened) widenedCells++;
+
+            currentRow[n] = best;
+        }
+        if (fillStopped()) break;
+        afterRow(k);
+    }
+
+    warmStats = WarmStartStats{cells, windowCosts, boundChecks, widenedCosts, widenedCells, fullCosts};
+    trace() << "Démarrage à chaud: " << cells << " cases, " << windowCosts + widenedCosts << " coûts exacts sur "
+              << fullCosts << " (" << widenedCosts << " hors fenêtre, " << widenedCells << " cases élargies)" << std::endl;
+}
+
+// Cases calculées par un solve complet : N en ligne 0, N - k en ligne k
+size_t SolverDP::fullSolveCells() const {
+    size_t cells = 0;
+    for (size_t k = 0; k < K && k < N; k++) cells += N - k;
+    return cells;
+}
+
+std::chrono::steady_clock::time_point SolverDP::beginFill() {
+    clusterSolutions.clear();
+    if (fillStartHook) fillStartHook();
+    return std::chrono::steady_clock::now();
+}
+
+void SolverDP::endFill(std::chrono::steady_clock::time_point start) {
+    fillSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (fillEndHook) fillEndHook();
+}
+
+SolverStats SolverDP::getStats() const {
+    SolverStats stats;
+    stats.fillSeconds = fillSeconds;
+    stats.distancePrecision = d.getPrecision();
+    stats.costCache = costCache.getStats();
+    stats.memoryPolicy = memoryPolicy;
+    stats.dpTable = matrixDP.getAllocation();
+    stats.bandCosts = bandCosts.getAllocation();
+    stats.distances = d.getAllocation();
+    stats.points = pointsAllocation;
+    stats.outOfCore = outOfCore;
+    stats.estimatedFootprint = estimateFootprint();
+    stats.spilledBytes = spilledBytes;
+    return stats;
+}
+
+void SolverDP::setCheckpoint(const string& path, double intervalSeconds) {
+    checkpointPath = path;
+    checkpointSeconds = intervalSeconds;
+}
+
+bool SolverDP::resume(const string& path) {
+    resumePath = path;
+    resumeAccepted = false;
+    solve();
+    resumePath.clear();
+    return resumeAccepted;
+}
+
+DPCheckpoint::Metadata SolverDP::checkpointMetadata() const {
+    DPCheckpoint::Metadata metadata;
+    metadata.datasetHash = DPCheckpoint::hashPoints(points);
+    if (!weights.empty()) metadata.datasetHash ^= DPCheckpoint::hashPoints(weights) * 31;
+    metadata.numPoints = N;
+    metadata.dim = D;
+    metadata.numClusters = K;
+    metadata.costType = usesSquaredDistance() ? 0 : 1;
+    metadata.maxLength = getMaxClusterLength();
+    metadata.minLength = minClusterLength;
+    metadata.mixedPrecision = mixedPrecision ? 1 : 0;
+    return metadata;
+}
+
+/**
+ * Validates the checkpoint given to resume() against the current solve (data
+ * hash, sizes, cost type, bounds, precision) and restores its completed rows
+ *
+ * @return false if the checkpoint is rejected (the solve is abandoned)
+ */
+bool SolverDP::restoreCheckpoint() {
+    if (outOfCore) {
+        std::cerr << "Erreur: reprise impossible en mode hors mémoire" << std::endl;
+        return false;
+    }
+
+    size_t completed;
+    string error;
+    if (!DPCheckpoint::load(resumePath, checkpointMetadata(), matrixDP, completed, error)) {
+        std::cerr << "Erreur: point de reprise " << resumePath << " rejeté (" << error << ")" << std::endl;
+        return false;
+    }
+
+    resumeAccepted = true;
+    resumedRows = static_cast<uint>(completed);
+    firstFillRow = std::max(1u, resumedRows);
+    trace() << "Reprise depuis " << resumePath << ": " << resumedRows << " lignes sur " << K << std::endl;
+
+    // Le même fichier continue de recevoir les points de reprise
+    if (checkpointPath.empty()) checkpointPath = resumePath;
+    return true;
+}
+
+void SolverDP::startCheckpoint() {
+    if (checkpointPath.empty()) return;
+    if (outOfCore) {
+        trace() << "Points de reprise désactivés en mode hors mémoire" << std::endl;
+        return;
+    }
+
+    size_t existingRows = checkpointPath == resumePath ? resumedRows : 0;
+    if (!checkpoint.open(checkpointPath, checkpointMetadata(), matrixDP, existingRows)) {
+        std::cerr << "Erreur: impossible d'ouvrir le point de reprise " << checkpointPath << std::endl;
+        return;
+    }
+    lastCheckpoint = std::chrono::steady_clock::now();
+}
+
+/**
+ * Called by the fill once row k is complete: hands rows [0, k] to the
+ * checkpoint writer when the interval has elapsed. The fill never waits
+ */
+void SolverDP::checkpointAfterRow(uint k) {
+    if (!checkpoint.isOpen()) return;
+
+    auto now = std::chrono::steady_clock::now();
+    if (std::chrono::duration<double>(now - lastCheckpoint).count() < checkpointSeconds) return;
+    if (checkpoint.requestAsync(k + 1)) lastCheckpoint = now;
+}
+
+/**
+ * Solves like solve() under a deadline and an optional cancellation token.
+ * After each row the fill measures its throughput (cells per second since
+ * the start of the fill) and stops before the next row when that row would
+ * end past the deadline; the token is read at every cell. An interrupted
+ * solve keeps the best fallback among the completed rows (see
+ * buildFallbackSolution) and is flagged as non-optimal. Always goes through
+ * the generic fill, hence refused (non-optimal outcome, nothing solved) by
+ * subclasses with their own fill
+ */
+SolveOutcome SolverDP::solveWithin(std::chrono::steady_clock::time_point solveDeadline,
+                                   const CancellationToken* token, ProgressCallback progress) {
+    if (!genericFillAvailable("solveWithin")) {
+        outcome = SolveOutcome{false, false, false, 0, 0, true, 0.0};
+        return outcome;
+    }
+    auto start = std::chrono::steady_clock::now();
+    anytime = true;
+    deadline = solveDeadline;
+    cancelToken = token;
+    progressCallback = std::move(progress);
+    stopFill.store(false);
+    outcome = SolveOutcome{false, false, false, 0, 0, true, 0.0};
+
+    SolverDP::solve();
+
+    anytime = false;
+    cancelToken = nullptr;
+    progressCallback = nullptr;
+    stopFill.store(false);
+    outcome.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return outcome;
+}
+
+// Refus d'un point d'entrée du remplissage générique par une sous-classe qui ne le prend pas en charge
+bool SolverDP::genericFillAvailable(const char* entry) const {
+    if (supportsGenericFill()) return true;
+    std::cerr << "Erreur: " << entry << " n'est pas disponible pour ce solveur (remplissage propre)" << std::endl;
+    return false;
+}
+
+/**
+ * Called by the fill once row k is complete: checkpoint, rebalancing of the
+ * thread team when the solve runs on a SolverPool, then, in a bounded solve,
+ * progress report and decision to go on. The remaining time assumes
+ * the throughput measured so far (row k has N - k cells)
+ */
+void SolverDP::afterRow(uint k) {
+    checkpointAfterRow(k);
+    SolverPool::rebalance();
+    if (!anytime) return;
+
+    rowsCompleted = std::max(rowsCompleted, k + 1);
+    auto now = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double>(now - fillStartTime).count();
+
+    size_t doneCells = 0, remainingCells = 0;
+    for (uint row = firstFillRow; row < K; row++) {
+        (row < rowsCompleted ? doneCells : remainingCells) += rowCells(row);
+    }
+    double secondsPerCell = doneCells > 0 ? elapsed / doneCells : 0.0;
+
+    if (progressCallback) {
+        progressCallback(SolveProgress{rowsCompleted, static_cast<unsigned>(K), elapsed, secondsPerCell * remainingCells});
+    }
+
+    if (rowsCompleted >= K) return;
+    double nextRowSeconds = secondsPerCell * rowCells(rowsCompleted);
+    if (fillStopped() || now + std::chrono::duration<double>(nextRowSeconds) > deadline) stopFill.store(true);
+}
+
+/**
+ * Best K-cluster solution available when the fill stopped early, among:
+ * the splits into K intervals of equal numbers of points and of equal arc
+ * length along the sorted points (each cut clamped so that every interval
+ * keeps a length within the bounds), and the optimal solution with fewer
+ * clusters of the last completed row, whose widest intervals are cut in
+ * halves (while they keep minClusterLength points) until there are K of
+ * them. Nothing in O(len²) runs past the deadline: the candidates are priced
+ * in O(1) per cluster from the band of costs when it was completed (every
+ * candidate interval has at most L points), otherwise in O(D) with the
+ * prefix-sum lower bound (centroid SSE), and the outcome then reports an
+ * estimated cost. Without the band, backtracking a row past the first one
+ * would recompute every cost, so that candidate is only kept from row 0
+ */
+void SolverDP::buildFallbackSolution() {
+    bool band = isLengthBounded() && bandComplete && bandCosts.getRows() == N;
+    if (!band) computePrefixSums();
+    auto price = [this, band](const vector<pair<uint, uint>>& intervals) {
+        double total = 0.0;
+        for (const auto& interval : intervals) {
+            uint length = interval.second - interval.first + 1;
+            total += band ? bandCosts.getRow(interval.second)[bandCosts.getCols() - length]
+                          : clusterCostLowerBound(interval.first, interval.second);
+        }
+        return total;
+    };
+
+    // Cluster c finit au dernier point de position <= (c+1)/K de la position finale, dans la plage admissible
+    auto split = [this](const vector<double>& position) {
+        long L = getMaxClusterLength(), m = minClusterLength, last = static_cast<long>(N) - 1;
+        vector<pair<uint, uint>> intervals;
+        long start = 0;
+        for (long c = 0; c < static_cast<long>(K); c++) {
+            long remaining = static_cast<long>(K) - c - 1;
+            double target = position.back() * (c + 1) / K;
+            long end = static_cast<long>(std::upper_bound(position.begin(), position.end(), target) - position.begin()) - 1;
+            end = std::min(std::max(end, std::max(start + m - 1, last - remaining * L)), std::min(start + L - 1, last - remaining * m));
+            intervals.push_back(make_pair(static_cast<uint>(start), static_cast<uint>(end)));
+            start = end + 1;
+        }
+        return intervals;
+    };
+
+    vector<double> position(N);
+    std::iota(position.begin(), position.end(), 1.0);
+    vector<pair<uint, uint>> best = split(position);
+    double bestCost = price(best);
+    uint coarseClusters = 0;
+
+    for (size_t i = 1; i < N; i++) position[i] = position[i - 1] + std::sqrt(squaredDistance(i - 1, i));
+    vector<pair<uint, uint>> arcSplit = split(position);
+    double arcCost = price(arcSplit);
+    if (arcCost < bestCost) {
+        best = arcSplit;
+        bestCost = arcCost;
+    }
+
+    // Hors mémoire, la dernière ligne complète n'est plus en mémoire
+    uint lastRow = rowsCompleted - 1;
+    if (rowsCompleted > 0 && !outOfCore && (band || lastRow == 0)
+        && matrixDP.getElement(lastRow, N - 1) < std::numeric_limits<double>::max()) {
+        buildSolutionFromMatrix(lastRow);
+        vector<pair<uint, uint>> intervals = solutionInterval;
+
+        while (intervals.size() < K) {
+            size_t widest = intervals.size();
+            uint widestLength = 2 * minClusterLength - 1;
+            for (size_t c = 0; c < intervals.size(); c++) {
+                uint length = intervals[c].second - intervals[c].first + 1;
+                if (length > widestLength) {
+                    widest = c;
+                    widestLength = length;
+                }
+            }
+            if (widest == intervals.size()) break;
+
+            uint middle = intervals[widest].first + widestLength / 2;
+            intervals.insert(intervals.begin() + widest + 1, make_pair(middle, intervals[widest].second));
+            intervals[widest].second = middle - 1;
+        }
+
+        if (intervals.size() == K) {
+            double cost = price(intervals);
+            if (cost < bestCost) {
+                best = intervals;
+                bestCost = cost;
+                coarseClusters = lastRow + 1;
+            }
+        }
+    }
+
+    solutionInterval = best;
+    solutionCost = bestCost;
+    outcome.optimal = false;
+    outcome.cancelled = cancelToken && cancelToken->isCancelled();
+    outcome.deadlineExpired = !outcome.cancelled;
+    outcome.fallbackClusters = coarseClusters;
+    outcome.exactCost = band && !mixedPrecision;
+    trace() << "Solve interrompu après " << rowsCompleted << "/" << K << " lignes ("
+              << (outcome.cancelled ? "annulé" : "échéance") << "): solution de repli "
+              << (coarseClusters > 0 ? "à " + std::to_string(coarseClusters) + " clusters redécoupée" : "par découpage")
+              << ", coût " << (outcome.exactCost ? "" : "estimé ") << solutionCost << std::endl;
+}
+
+void SolverDP::setMemoryBudget(size_t bytes, const string& directory) {
+    memoryBudget = bytes;
+    scratchDirectory = directory;
+}
+
+/**
+ * Estimates the memory needed by an in-core solve: DP table, cost band of the
+ * bounded mode, distance matrix (once prepared) and points
+ */
+size_t SolverDP::estimateFootprint() const {
+    size_t bytes = static_cast<size_t>(K) * N * sizeof(double);
+    if (isLengthBounded()) bytes += static_cast<size_t>(N) * getMaxClusterLength() * sizeof(double);
+    bytes += d.getBytes();
+    bytes += points.size() * sizeof(double);
+    return bytes;
+}
+
+/**
+ * Applies the memory policy to the sorted points: they are read by every
+ * thread, so only interleaving and huge page advice are relevant
+ */
+void SolverDP::applyPointsPolicy() {
+    memoryPolicy::apply(points.data(), points.size() * sizeof(double), memoryPolicy, pointsAllocation);
 }
 
 bool SolverDP::validateInputs() {
-    return N > 0 && K > 0;
+    if (N == 0 || K == 0) return false;
+
+    if (minClusterLength > getMaxClusterLength()) {
+        std::cerr << "Erreur: taille minimale de cluster (" << minClusterLength
+                  << ") supérieure à la taille maximale (" << getMaxClusterLength() << ")" << std::endl;
+        return false;
+    }
+    if (static_cast<size_t>(getMaxClusterLength()) * K < N || static_cast<size_t>(minClusterLength) * K > N) {
+        std::cerr << "Erreur: impossible de partitionner " << N << " points en " << K
+                  << " clusters de taille [" << minClusterLength << ", " << getMaxClusterLength() << "]" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void SolverDP::setClusterLengthBounds(uint maxLength, uint minLength) {
+    maxClusterLength = maxLength;
+    minClusterLength = std::max(1u, minLength);
+}
+
+uint SolverDP::getMaxClusterLength() const {
+    if (maxClusterLength == 0 || maxClusterLength > N) return static_cast<uint>(N);
+    return maxClusterLength;
+}
+
+void SolverDP::setDistanceMatrixBudget(size_t bytes, bool allowFloat) {
+    distanceBudget = bytes;
+    allowFloatDistances = allowFloat;
+}
+
+/**
+ * Builds the packed pairwise distance matrix on the sorted points when it fits
+ * in the memory budget: double if possible, otherwise float if allowed
+ */
+void SolverDP::prepareDistanceMatrix() {
+    d.clear();
+    if (distanceBudget == 0) return;
+
+    DistanceMatrix::Precision precision = DistanceMatrix::NONE;
+    if (mixedPrecision) {
+        if (DistanceMatrix::bytesFor(N, DistanceMatrix::FLOAT32) <= distanceBudget) {
+            precision = DistanceMatrix::FLOAT32;
+        }
+    } else if (DistanceMatrix::bytesFor(N, DistanceMatrix::FLOAT64) <= distanceBudget) {
+        precision = DistanceMatrix::FLOAT64;
+    } else if (allowFloatDistances && DistanceMatrix::bytesFor(N, DistanceMatrix::FLOAT32) <= distanceBudget) {
+        precision = DistanceMatrix::FLOAT32;
+    }
+
+    if (precision == DistanceMatrix::NONE) {
+        trace() << "Matrice des distances: hors budget (" << distanceBudget << " octets), calcul à la volée" << std::endl;
+        return;
+    }
+
+    d.build(points, N, D, usesSquaredDistance(), precision, memoryPolicy);
+    trace() << "Matrice des distances précalculée (" << DistanceMatrix::precisionName(precision)
+              << ", " << d.getBytes() << " octets)" << std::endl;
+}
+
+/**
+ * Precomputes, once for all rows, the costs of every admissible cluster
+ * (at most L points) ending at each index: an N x L band instead of
+ * recomputing the same costs for each of the K rows
+ */
+void SolverDP::fillBandCosts() {
+    uint L = getMaxClusterLength();
+    bandCosts.initMatrix(N, L, memoryPolicy);
+
+    bool useParallel = (N > 50);
+
+    // Chaque ligne est écrite pour la première fois par le thread qui la remplira
+    // dans les lignes de la DP (même ordonnancement en premier accès)
+#pragma omp parallel if(useParallel)
+    {
+        vector<double> costs(L, 0.0);
+
+#pragma omp for schedule(runtime)
+        for (uint n = firstFillColumn; n < N; n++) {
+            // Solve borné : la bande fait partie du temps imparti (la DP ne démarre pas si elle est incomplète)
+            if (fillInterrupted()) continue;
+            clusterCostsBefore(n, costs);
+            std::reverse_copy(costs.begin(), costs.end(), bandCosts.getRow(n)); // Rangement par split
+        }
+    }
+
+    bandComplete = !fillStopped();
+
+    trace() << "Mode borné: tailles de cluster dans [" << minClusterLength << ", " << L
+              << "], bande de coûts " << bandCosts.getRows() << "x" << bandCosts.getCols() << std::endl;
+}
+
+/**
+ * Returns the cost of the cluster [start, end], through the interval cost
+ * cache when it is enabled
+ */
+double SolverDP::clusterCost(uint start, uint end) const {
+    double cost;
+    if (costCache.lookup(start, end, cost)) return cost;
+
+    cost = mixedPrecision ? calculateClusterCostFloat(start, end) : calculateClusterCost(start, end);
+    costCache.insert(start, end, cost);
+    return cost;
+}
+
+namespace {
+
+// Somme compensée de Kahan en float ; addBlocked somme d'abord des blocs de 8 valeurs
+// (vectorisables) puis compense l'accumulation des blocs
+struct KahanSum {
+    float value = 0.0f;
+    float compensation = 0.0f;
+
+    inline void add(float x) {
+        float y = x - compensation;
+        float t = value + y;
+        compensation = (t - value) - y;
+        value = t;
+    }
+
+    inline void addBlocked(const float* x, size_t count) {
+        const size_t BLOCK = 8;
+        size_t i = 0;
+        for (; i + BLOCK <= count; i += BLOCK) {
+            float block = 0.0f;
+#pragma omp simd reduction(+:block)
+            for (size_t l = 0; l < BLOCK; l++) block += x[i + l];
+            add(block);
+        }
+        for (; i < count; i++) add(x[i]);
+    }
+};
+
+}
+
+/**
+ * Calculates the cluster cost in single precision for the mixed-precision mode:
+ * float coordinates (or the float distance matrix) and a Kahan-compensated sum
+ * per candidate center, so the error does not grow with the cluster size. With
+ * the matrix, the points after the center are read along its contiguous row
+ *
+ * @param start Starting index of the cluster (inclusive)
+ * @param end Ending index of the cluster (inclusive)
+ * @return Minimum cost over the candidate centers of the cluster
+ */
+double SolverDP::calculateClusterCostFloat(uint start, uint end) const {
+    if (start >= end) return 0.0;
+
+    bool squared = usesSquaredDistance();
+    bool useMatrix = d.getPrecision() == DistanceMatrix::FLOAT32;
+    float minCost = std::numeric_limits<float>::max();
+    bool useParallel = (end - start + 1 > 20);
+
+#pragma omp parallel for if(useParallel) reduction(min:minCost) schedule(dynamic)
+    for (uint center = start; center <= end; center++) {
+        KahanSum sum;
+
+        if (useMatrix && !weights.empty()) {
+            for (uint i = start; i <= end; i++) {
+                if (i == center) continue;
+                float dist = i < center ? d.getFloatUpper(i, center) : d.getFloatUpper(center, i);
+                sum.add(static_cast<float>(weights[i]) * dist);
+            }
+        } else if (useMatrix) {
+            // Points avant le centre : colonne du triangle supérieur
+            for (uint i = start; i < center; i++) {
+                sum.add(d.getFloatUpper(i, center));
+            }
+            // Points après le centre : ligne contiguë, sommée par blocs
+            sum.addBlocked(d.rowFloat(center), end - center);
+        } else {
+            for (uint i = start; i <= end; i++) {
+                if (i == center) continue;
+                float dist = squaredDistanceFloat(i, center);
+                sum.add(static_cast<float>(pointWeight(i)) * (squared ? dist : std::sqrt(dist)));
+            }
+        }
+
+        if (sum.value < minCost) minCost = sum.value;
+    }
+
+    return static_cast<double>(minCost);
+}
+
+/**
+ * Calculates the cluster cost in double precision from the coordinates,
+ * independently of the distance matrix and of the cost cache
+ */
+double SolverDP::exactClusterCost(uint start, uint end) const {
+    double cost;
+    exactClusterCenter(start, end, cost);
+    return cost;
+}
+
+/**
+ * Finds the medoid (squared distances) or discrete median (distances) of the
+ * cluster [start, end]: the first point minimizing the cost
+ *
+ * @param cost Output: cost of the cluster around that point
+ * @return Index of the center in the sorted order
+ */
+size_t SolverDP::exactClusterCenter(uint start, uint end, double& cost) const {
+    cost = 0.0;
+    if (start >= end) return start;
+
+    bool squared = usesSquaredDistance();
+    double minCost = std::numeric_limits<double>::max();
+    size_t best = start;
+
+    for (uint center = start; center <= end; center++) {
+        double centerCost = 0.0;
+        for (uint i = start; i <= end; i++) {
+            if (i == center) continue;
+            double dist = squaredDistance(i, center);
+            centerCost += pointWeight(i) * (squared ? dist : std::sqrt(dist));
+        }
+        if (centerCost < minCost) {
+            minCost = centerCost;
+            best = center;
+        }
+    }
+    cost = minCost;
+    return best;
+}
+
+void SolverDP::computeIntervalCenters() {
+    intervalCenters.assign(solutionInterval.size(), 0);
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t c = 0; c < solutionInterval.size(); c++) {
+        double cost;
+        intervalCenters[c] = exactClusterCenter(solutionInterval[c].first, solutionInterval[c].second, cost);
+    }
+}
+
+AssignmentIndex SolverDP::buildAssignmentIndex() const {
+    AssignmentIndex index;
+    index.build(points, D, solutionInterval, intervalCenters);
+    return index;
 }
 
+/**
+ * Replaces the mixed-precision DP cost by the exact double cost of the
+ * solution intervals and reports the difference
+ */
+void SolverDP::recheckSolutionCost() {
+    mixedPrecisionCost = solutionCost;
+
+    double exactCost = 0.0;
+#pragma omp parallel for reduction(+:exactCost) schedule(dynamic)
+    for (size_t c = 0; c < solutionInterval.size(); c++) {
+        exactCost += exactClusterCost(solutionInterval[c].first, solutionInterval[c].second);
+    }
+    solutionCost = exactCost;
+
+    double delta = mixedPrecisionCost - solutionCost;
+    trace() << "Précision mixte: coût DP float = " << mixedPrecisionCost
+              << ", coût exact double = " << solutionCost
+              << ", écart = " << delta << " (" << (solutionCost > 0 ? 100.0 * delta / solutionCost : 0.0)
+              << "%)" << std::endl;
+}
+
+/**
+ * Returns the costs of the clusters ending at n in split order (as expected by
+ * findOptimalSplit): the precomputed band row in bounded mode, otherwise the
+ * buffer filled by clusterCostsBefore then reversed
+ */
+const double* SolverDP::costsEndingAt(uint n, vector<double>& buffer) {
+    if (isLengthBounded() && n < bandCosts.getRows()) {
+        return bandCosts.getRow(n);
+    }
+    clusterCostsBefore(n, buffer);
+    std::reverse(buffer.begin(), buffer.end());
+    return buffer.data();
+}
+
+/**
+ * Allocates the DP table and fills it with the max() sentinel. With the
+ * first-touch placement, each row is written with the same static partition
+ * as the loop that will fill it (columns k..N-1, or column blocks when tiled),
+ * so that its pages live on the node of the thread computing them
+ */
 void SolverDP::initializeMatrix() {
-    matrixDP.initMatrix(K, N); // K lignes, N colonnes
+    matrixDP.initMatrix(K, N, memoryPolicy); // K lignes, N colonnes
 
     // Parallélisation de l'initialisation pour les grandes matrices
     bool useParallel = (K * N > 10000);
+    const double sentinel = std::numeric_limits<double>::max();
+
+    if (memoryPolicy.placement == MemoryPlacement::FIRST_TOUCH) {
+        if (wavefrontFill) {
+            std::cerr << "Attention: placement FIRST_TOUCH avec le remplissage en pipeline, dont les blocs sont "
+                      << "distribués dynamiquement : les pages ne suivent pas les threads qui les remplissent "
+                      << "(MemoryPlacement::INTERLEAVE conseillé)" << std::endl;
+        }
+        uint columns = 1, splits;
+        if (tiledFill) resolveTileSizes(columns, splits);
+        size_t numBlocks = (N + columns - 1) / columns;
 
+#pragma omp parallel if(useParallel)
+        for (size_t k = 0; k < K; k++) {
+            double* row = matrixDP.getRow(k);
+            if (tiledFill) {
+#pragma omp for schedule(static)
+                for (size_t block = 0; block < numBlocks; block++) {
+                    size_t n1 = std::min(N, (block + 1) * columns);
+                    std::fill(row + block * columns, row + n1, sentinel);
+                }
+            } else {
+#pragma omp for schedule(static)
+                for (size_t n = std::min(k, N); n < N; n++) {
+                    row[n] = sentinel;
+                }
+#pragma omp single
+                std::fill(row, row + std::min(k, N), sentinel);
+            }
+        }
+    } else {
 #pragma omp parallel for collapse(2) if(useParallel)
-    for (size_t k = 0; k < K; k++) {
-        for (size_t n = 0; n < N; n++) {
-            matrixDP.setElement(k, n, std::numeric_limits<double>::max());
+        for (size_t k = 0; k < K; k++) {
+            for (size_t n = 0; n < N; n++) {
+                matrixDP.setElement(k, n, sentinel);
+            }
         }
     }
 
-    std::cout << "Matrice initialisée avec " << matrixDP.getRows()
+    trace() << "Matrice initialisée avec " << matrixDP.getRows()
               << " lignes et " << matrixDP.getCols() << " colonnes" << std::endl;
 }
 
+/**
+ * Out-of-core mode: only rows k-1 and k of the DP are kept in memory (row k
+ * lives in slot k % 2), completed rows go to the spill file
+ */
+void SolverDP::initializeRowRing() {
+    matrixDP.initMatrix(2, N, memoryPolicy);
+    for (size_t k = 0; k < 2; k++) {
+        double* row = matrixDP.getRow(k);
+        std::fill(row, row + N, std::numeric_limits<double>::max());
+    }
+
+    spill.open(scratchDirectory, K, N);
+    spilledBytes = spill.getBytes();
+    trace() << "DP hors mémoire: empreinte estimée " << estimateFootprint() << " octets > budget "
+              << memoryBudget << ", lignes déversées dans " << scratchDirectory
+              << " (" << spilledBytes << " octets)" << std::endl;
+}
+
 void SolverDP::fillFirstLine(vector<double>& v) {
     if (N == 0) return;
 
-    std::cout << "DEBUG fillFirstLine: calling clusterCostsFromBeginning" << std::endl;
     clusterCostsFromBeginning(v);
 
-    std::cout << "DEBUG fillFirstLine: v = ";
-    for (size_t i = 0; i < v.size(); i++) {
-        std::cout << v[i] << " ";
-    }
-    std::cout << std::endl;
-
     // Remplir la première ligne séquentiellement (dépendances)
     for (uint n = 0; n < N && n < matrixDP.getCols(); n++) {
-        if (n < v.size()) {
+        if (n < v.size() && n + 1 >= minClusterLength) {
             matrixDP.setElement(0, n, v[n]);
-            std::cout << "DEBUG: matrixDP[0][" << n << "] = " << v[n] << std::endl;
         }
     }
 }
 
 void SolverDP::fillDPMatrix(vector<double>& v) {
+    if (wavefrontFill) {
+        fillDPMatrixWavefront(v.size());
+        return;
+    }
+    if (tiledFill) {
+        fillDPMatrixTiled(v.size());
+        return;
+    }
+
     // La DP impose des dépendances entre lignes, mais les colonnes d'une même ligne
     // peuvent être calculées en parallèle
-    for (uint k = 1; k < K && k < matrixDP.getRows(); k++) {
+    for (uint k = firstFillRow; k < K && k < matrixDP.getRows() && !fillStopped(); k++) {
 
         // Parallélisation des colonnes d'une même ligne
         bool useParallel = (N > 50);
@@ -77,13 +1375,14 @@ void SolverDP::fillDPMatrix(vector<double>& v) {
 #pragma omp parallel if(useParallel)
         {
             // Chaque thread a son propre vecteur v local
-            vector<double> local_v(N, 0.0);
+            vector<double> local_v(v.size(), 0.0);
 
-#pragma omp for schedule(dynamic)
-            for (uint n = k; n < N; n++) {
+#pragma omp for schedule(runtime)
+            for (uint n = std::max(k, firstFillColumn); n < N; n++) {
+                if (fillInterrupted(n)) continue;
                 // Calculer les coûts pour cette position
-                clusterCostsBefore(n, local_v);
-                OptimalSplit optSplit = findOptimalSplit(k, n, local_v);
+                const double* costs = costsEndingAt(n, local_v);
+                OptimalSplit optSplit = findOptimalSplit(k, n, costs, v.size());
 
                 if (k < matrixDP.getRows() && n < matrixDP.getCols()) {
 /*
@@ -92,101 +1391,339 @@ void SolverDP::fillDPMatrix(vector<double>& v) {
 */
                         matrixDP.setElement(k, n, optSplit.cost);
 /*
-                        std::cout << "DEBUG: matrixDP[" << k << "][" << n << "] = " << optSplit.cost
+                        trace() << "DEBUG: matrixDP[" << k << "][" << n << "] = " << optSplit.cost
                                   << " (split=" << optSplit.splitPoint << ")" << std::endl;
                      }
 */
                 }
             }
         }
+        if (fillStopped()) break;
+        afterRow(k);
     }
 }
 
-SolverDP::OptimalSplit SolverDP::findOptimalSplit(uint k, uint n, const vector<double>& v) {
-    OptimalSplit result;
-    result.cost = std::numeric_limits<double>::max();
-    result.splitPoint = 0;
-    result.isValid = false;
+/**
+ * Fills the DP rows with two rows in memory. Each completed row is copied,
+ * with the argmin of each cell, into the write-behind queue of the spill file,
+ * so its slot can be reused at once; the fill only waits for the disk when
+ * the queue is full
+ */
+void SolverDP::fillDPMatrixOutOfCore(vector<double>& v) {
+    spill.writeRow(0, matrixDP.getRow(0), vector<uint32_t>(N, 0));
 
-    std::cout << "    findOptimalSplit: k=" << k << " n=" << n << " v.size()=" << v.size() << std::endl;
+    bool useParallel = (N > 50);
 
-    // Parallélisation de la recherche du split optimal pour les grandes instances
-    uint numSplits = n - (k-1);
-    bool useParallel = (numSplits > 20);
+    for (uint k = 1; k < K && !fillStopped(); k++) {
+        const double* previousRow = matrixDP.getRow((k - 1) % 2);
+        double* currentRow = matrixDP.getRow(k % 2);
+        vector<uint32_t> argmins(N, 0);
 
-    // Variables pour la réduction personnalisée
-    double bestCost = std::numeric_limits<double>::max();
-    uint bestSplit = 0;
-    bool foundValid = false;
+        std::fill(currentRow, currentRow + std::min<size_t>(k, N), std::numeric_limits<double>::max());
 
 #pragma omp parallel if(useParallel)
-    {
-        double localBestCost = std::numeric_limits<double>::max();
-        uint localBestSplit = 0;
-        bool localFoundValid = false;
+        {
+            vector<double> local_v(v.size(), 0.0);
+
+#pragma omp for schedule(runtime)
+            for (uint n = std::max(k, firstFillColumn); n < N; n++) {
+                if (fillInterrupted(n)) continue;
+                const double* costs = costsEndingAt(n, local_v);
+                OptimalSplit optSplit = findOptimalSplit(previousRow, k, n, costs, v.size());
+                currentRow[n] = optSplit.cost;
+                argmins[n] = optSplit.splitPoint;
+            }
+        }
 
-#pragma omp for
-        for (uint split = k-1; split < n; split++) {
-            if (split < matrixDP.getCols()) {
-                double leftCost = matrixDP.getElement(k-1, split);
-                uint clusterSize = n - split;
+        if (fillStopped()) break;
+        spill.writeRow(k, currentRow, std::move(argmins));
+        afterRow(k);
+    }
+    spill.flush();
+}
 
-                if (clusterSize > 0 && clusterSize - 1 < v.size()) {
-                    double rightCost = v[clusterSize - 1];
-                    double totalCost = leftCost + rightCost;
+/**
+ * Backtracks through the spilled argmin rows, from row K-1 down to row 1,
+ * advising the kernel to read the next row ahead while the current one is used
+ */
+void SolverDP::buildSolutionFromSpill() {
+    solutionInterval.clear();
 
-/*
-#pragma omp critical
-                    {
-                        std::cout << "      split=" << split << " leftCost=" << leftCost
-                                  << " clusterSize=" << clusterSize << " rightCost=" << rightCost
-                                  << " totalCost=" << totalCost << std::endl;
-                    }
-*/
+    uint currentK = K - 1;
+    uint currentN = N - 1;
+    spill.prefetch(currentK);
 
-                    if (totalCost < localBestCost &&
-                        leftCost != std::numeric_limits<double>::max() &&
-                        rightCost != std::numeric_limits<double>::max()) {
-                        localBestCost = totalCost;
-                        localBestSplit = split;
-                        localFoundValid = true;
-                    }
-                }
+    while (currentK > 0) {
+        spill.prefetch(currentK - 1);
+        if (spill.costRow(currentK)[currentN] == std::numeric_limits<double>::max()) break;
+
+        uint splitPoint = spill.argminRow(currentK)[currentN];
+        solutionInterval.push_back(make_pair(splitPoint + 1, currentN));
+        currentN = splitPoint;
+        currentK--;
+    }
+
+    if (currentK == 0) {
+        solutionInterval.push_back(make_pair(0, currentN));
+    }
+
+    reverse(solutionInterval.begin(), solutionInterval.end());
+}
+
+void SolverDP::setFillTiling(bool enabled, uint columnTileSize, uint splitTileSize) {
+    tiledFill = enabled;
+    columnTile = columnTileSize;
+    splitTile = splitTileSize;
+}
+
+/**
+ * Chooses the tile sizes left at 0 from the cache sizes: a slice of splitTile
+ * values of row k-1 fills half of L1, and the slices of the columnTile cost
+ * vectors for that split block fill half of L2
+ */
+void SolverDP::resolveTileSizes(uint& columns, uint& splits) const {
+    long l1 = 32 * 1024;
+    long l2 = 256 * 1024;
+#ifdef _SC_LEVEL1_DCACHE_SIZE
+    if (sysconf(_SC_LEVEL1_DCACHE_SIZE) > 0) l1 = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+    if (sysconf(_SC_LEVEL2_CACHE_SIZE) > 0) l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+
+    splits = splitTile > 0 ? splitTile : static_cast<uint>(std::max(64L, l1 / (2 * static_cast<long>(sizeof(double)))));
+    columns = columnTile > 0 ? columnTile
+                             : static_cast<uint>(std::max(1L, l2 / (2 * static_cast<long>(splits * sizeof(double)))));
+}
+
+/**
+ * Fills rows 1..K-1 by tiles: for a block of target columns, the split range is
+ * swept block by block, so the same slice of row k-1 is reused by every column
+ * of the block while it is resident in L1, and each column's cost slice is
+ * read once per split block. Split blocks are visited in increasing order and
+ * only a strictly smaller cost replaces the running minimum, so the result is
+ * identical to the full scan of findOptimalSplit (smallest split on ties)
+ *
+ * @param costLength Length of the split-ordered cost vectors (N, or L in bounded mode)
+ */
+void SolverDP::fillDPMatrixTiled(size_t costLength) {
+    uint columns, splits;
+    resolveTileSizes(columns, splits);
+    trace() << "Remplissage par tuiles: " << columns << " colonnes x " << splits << " splits" << std::endl;
+
+    size_t numBlocks = (N + columns - 1) / columns;
+
+    for (uint k = firstFillRow; k < K && k < matrixDP.getRows() && !fillStopped(); k++) {
+        bool useParallel = (N > 50);
+
+#pragma omp parallel if(useParallel)
+        {
+            BlockBuffers buffers(columns, isLengthBounded() ? 0 : costLength);
+
+#pragma omp for schedule(runtime)
+            for (size_t block = 0; block < numBlocks; block++) {
+                if (fillInterrupted()) continue;
+                uint n0 = std::max(std::max(k, firstFillColumn), static_cast<uint>(block * columns));
+                uint n1 = static_cast<uint>(std::min(N, (block + 1) * columns));
+                fillBlock(k, n0, n1, costLength, splits, buffers);
             }
         }
+        if (fillStopped()) break;
+        afterRow(k);
+    }
+}
 
-        // Réduction manuelle pour trouver le meilleur résultat global
-#pragma omp critical
-        {
-            if (localFoundValid && localBestCost < bestCost) {
-                bestCost = localBestCost;
-                bestSplit = localBestSplit;
-                foundValid = true;
+/**
+ * Fills the cells [n0, n1) of row k: by split blocks of splits values as
+ * described in fillDPMatrixTiled, or with one full scan per column when
+ * splits == 0
+ */
+void SolverDP::fillBlock(uint k, uint n0, uint n1, size_t costLength, uint splits, BlockBuffers& buffers) {
+    if (n0 >= n1) return;
+    const double* previousRow = matrixDP.getRow(k-1);
+    double* currentRow = matrixDP.getRow(k);
+
+    if (splits == 0) {
+        for (uint n = n0; n < n1; n++) {
+            const double* costs = costsEndingAt(n, buffers.columnCosts[0]);
+            currentRow[n] = findOptimalSplit(previousRow, k, n, costs, costLength).cost;
+        }
+        return;
+    }
+
+    vector<const double*>& costs = buffers.costs;
+    vector<double>& bestCost = buffers.bestCost;
+    uint splitBegin = n1, splitEnd = 0;
+    for (uint n = n0; n < n1; n++) {
+        uint first, end;
+        costs[n - n0] = costsEndingAt(n, buffers.columnCosts[n - n0]);
+        bestCost[n - n0] = std::numeric_limits<double>::max();
+        if (splitWindow(k, n, costLength, first, end)) {
+            splitBegin = std::min(splitBegin, first);
+            splitEnd = std::max(splitEnd, end);
+        }
+    }
+
+    for (uint s0 = splitBegin; s0 < splitEnd; s0 += splits) {
+        uint s1 = std::min(splitEnd, s0 + splits);
+
+        for (uint n = n0; n < n1; n++) {
+            uint first, end;
+            if (!splitWindow(k, n, costLength, first, end)) continue;
+            uint lo = std::max(first, s0);
+            uint hi = std::min(end, s1);
+            if (lo >= hi) continue;
+
+            // costs[.][t] = coût du cluster [split+1, n] avec t = split + costLength - n
+            ArgminResult best = argminSum(previousRow + lo, costs[n - n0] + (lo + costLength - n), hi - lo);
+            if (best.value < bestCost[n - n0]) {
+                bestCost[n - n0] = best.value;
             }
         }
     }
 
-    if (foundValid) {
-        result.cost = bestCost;
-        result.splitPoint = bestSplit;
-        result.isValid = true;
+    for (uint n = n0; n < n1; n++) {
+        currentRow[n] = bestCost[n - n0];
+    }
+}
+
+/**
+ * Pipelined fill: the work items are the column blocks of every row, handed
+ * out in row-major order through an atomic ticket. Block b of row k only reads
+ * row k-1 up to its own last column, so it waits until the blocks 0..b of row
+ * k-1 are published instead of waiting for the whole row: row k starts on its
+ * first columns while row k-1 is still finishing the last ones. Each row has
+ * a progress counter (blocks published, in order). A thread only waits for
+ * smaller tickets, all taken by running threads, so the pipeline cannot
+ * deadlock; every cell is computed as in the row-by-row fill
+ *
+ * @param costLength Length of the split-ordered cost vectors (N, or L in bounded mode)
+ */
+void SolverDP::fillDPMatrixWavefront(size_t costLength) {
+    uint columns, splits = 0;
+    if (tiledFill) resolveTileSizes(columns, splits);
+    if (wavefrontColumns > 0) {
+        columns = wavefrontColumns;
+    } else if (!tiledFill) {
+#ifdef _OPENMP
+        size_t threads = static_cast<size_t>(omp_get_max_threads());
+#else
+        size_t threads = 1;
+#endif
+        columns = static_cast<uint>(std::max<size_t>(16, N / (8 * threads)));
+    }
+
+    size_t numBlocks = (N + columns - 1) / columns;
+    size_t numRows = K > firstFillRow ? K - firstFillRow : 0;
+    size_t tickets = numRows * numBlocks;
+    trace() << "Remplissage en pipeline: blocs de " << columns << " colonnes"
+              << (tiledFill ? " (tuiles de " + std::to_string(splits) + " splits)" : "") << std::endl;
+
+    // progress[k] : blocs de la ligne k publiés ; les lignes avant firstFillRow sont complètes
+    std::unique_ptr<std::atomic<size_t>[]> progress(new std::atomic<size_t>[K]);
+    for (size_t k = 0; k < K; k++) progress[k].store(k < firstFillRow ? numBlocks : 0);
+    std::atomic<size_t> nextTicket(0);
+
+    bool useParallel = (N > 50);
+
+#pragma omp parallel if(useParallel)
+    {
+        BlockBuffers buffers(tiledFill ? columns : 1, isLengthBounded() ? 0 : costLength);
+
+        // Après un arrêt, les blocs non publiés ne le seront jamais : les attentes abandonnent
+        bool running = true;
+        while (running) {
+            size_t ticket = nextTicket.fetch_add(1);
+            if (ticket >= tickets || fillInterrupted()) break;
+            uint k = firstFillRow + static_cast<uint>(ticket / numBlocks);
+            size_t block = ticket % numBlocks;
+
+            while (running && progress[k-1].load(std::memory_order_acquire) <= block) {
+                running = !fillStopped();
+                std::this_thread::yield();
+            }
+            if (!running) break;
+
+            uint n0 = std::max(std::max(k, firstFillColumn), static_cast<uint>(block * columns));
+            uint n1 = static_cast<uint>(std::min(N, (block + 1) * columns));
+            fillBlock(k, n0, n1, costLength, splits, buffers);
+            // Bloc interrompu pendant ses coûts : il n'est jamais publié
+            if (fillStopped()) break;
+
+            // Publication dans l'ordre des blocs : progress[k] = b garantit les blocs 0..b-1
+            while (running && progress[k].load(std::memory_order_acquire) != block) {
+                running = !fillStopped();
+                std::this_thread::yield();
+            }
+            if (!running) break;
+            progress[k].store(block + 1, std::memory_order_release);
+
+            if (block + 1 == numBlocks) {
+#pragma omp critical(dpCheckpoint)
+                afterRow(k);
+            }
+        }
+    }
+}
+
+/**
+ * Computes the admissible splits of cell (k, n): the last cluster [split+1, n]
+ * must have between minClusterLength and costLength points, and the k first
+ * clusters need at least k points
+ *
+ * @return false when no split is admissible
+ */
+bool SolverDP::splitWindow(uint k, uint n, size_t costLength, uint& first, uint& end) const {
+    first = k - 1;
+    if (n >= costLength && n - costLength > first) {
+        first = static_cast<uint>(n - costLength);
     }
+    end = (n + 1 >= minClusterLength) ? n + 1 - minClusterLength : 0;
+    return first < end;
+}
 
-    std::cout << "    --> bestCost=" << result.cost << " bestSplit=" << result.splitPoint << std::endl;
+SolverDP::OptimalSplit SolverDP::findOptimalSplit(uint k, uint n, const double* v, size_t costLength) {
+    return findOptimalSplit(matrixDP, k, n, v, costLength);
+}
+
+SolverDP::OptimalSplit SolverDP::findOptimalSplit(const double* previousRow, uint k, uint n, const double* v, size_t costLength) const {
+    OptimalSplit result;
+    result.cost = std::numeric_limits<double>::max();
+    result.splitPoint = 0;
+    result.isValid = false;
+
+    uint firstSplit, endSplit;
+    if (!splitWindow(k, n, costLength, firstSplit, endSplit)) return result;
+
+    // v est rangé par split : v[t] = coût du cluster de costLength - t points finissant en n,
+    // donc right[split] = coût du cluster [split+1, n] et les deux flux sont lus en avant
+    const double* left = previousRow + firstSplit;
+    const double* right = v + (firstSplit + costLength - n);
+
+    ArgminResult best = argminSum(left, right, endSplit - firstSplit);
+
+    // Une somme impliquant une sentinelle max() n'est jamais retenue
+    if (best.value < std::numeric_limits<double>::max()) {
+        result.cost = best.value;
+        result.splitPoint = firstSplit + static_cast<uint>(best.index);
+        result.isValid = true;
+    }
     return result;
 }
 
-void SolverDP::buildSolutionFromMatrix() {
+/**
+ * Backtracks the optimal partition of all N points into lastRow + 1
+ * clusters from row lastRow (K - 1 for a complete solve)
+ */
+void SolverDP::buildSolutionFromMatrix(uint lastRow) {
     solutionInterval.clear();
 
     // Le backtracking est séquentiel par nature (dépendances)
-    uint currentK = K - 1;
+    uint currentK = lastRow;
     uint currentN = N - 1;
-    vector<double> v(N, 0.0);
+    vector<double> v(getMaxClusterLength(), 0.0);
 
     while (currentK > 0) {
-        clusterCostsBefore(currentN, v);
-        OptimalSplit optSplit = findOptimalSplit(currentK, currentN, v);
+        const double* costs = costsEndingAt(currentN, v);
+        OptimalSplit optSplit = findOptimalSplit(currentK, currentN, costs, v.size());
 
         if (optSplit.isValid) {
             solutionInterval.push_back(make_pair(optSplit.splitPoint + 1, currentN));
@@ -203,16 +1740,17 @@ void SolverDP::buildSolutionFromMatrix() {
 
     reverse(solutionInterval.begin(), solutionInterval.end());
 
-    std::cout << "\nIntervalles reconstruits:" << std::endl;
+    trace() << "\nIntervalles reconstruits:" << std::endl;
     for (size_t i = 0; i < solutionInterval.size(); i++) {
-        std::cout << "Cluster " << i+1 << ": [" << solutionInterval[i].first
+        trace() << "Cluster " << i+1 << ": [" << solutionInterval[i].first
                   << ", " << solutionInterval[i].second << "]" << std::endl;
     }
 }
 
 void SolverDP::calculateFinalCost() {
-    if (K-1 < matrixDP.getRows() && N-1 < matrixDP.getCols()) {
-        solutionCost = matrixDP.getElement(K-1, N-1);
+    size_t lastRow = outOfCore ? (K-1) % 2 : K-1;
+    if (lastRow < matrixDP.getRows() && N-1 < matrixDP.getCols()) {
+        solutionCost = matrixDP.getElement(lastRow, N-1);
     } else {
         solutionCost = std::numeric_limits<double>::max();
     }
@@ -249,7 +1787,7 @@ double SolverDP::calculateRealClusterCost() const {
 }
 
 bool SolverDP::isMatrixAvailable() {
-    return matrixDP.getRows() > 0 && matrixDP.getCols() > 0;
+    return !outOfCore && matrixDP.getRows() > 0 && matrixDP.getCols() > 0;
 }
 
 void SolverDP::printMatrixDP() {
@@ -258,8 +1796,8 @@ void SolverDP::printMatrixDP() {
     std::cout << "\n=== MATRICE DP ===" << std::endl;
     for (int k = K-1; k >= 0; k--) {
         std::cout << "k=" << k << ": ";
-        for (uint n = 0; n < N; n++) {
-            if (k < static_cast<int>(matrixDP.getRows()) && n < matrixDP.getCols()) {
+        for (uint n = 0; n < matrixDP.getCols(); n++) {
+            if (k < static_cast<int>(matrixDP.getRows())) {
                 double val = matrixDP.getElement(k, n);
                 if (val == std::numeric_limits<double>::max()) {
                     std::cout << "∞ ";
@@ -278,8 +1816,9 @@ void SolverDP::printFinalCosts(string sep) {
     if (!isMatrixAvailable()) return;
 
     for (uint k = 0; k < K; k++) {
-        if (k < matrixDP.getRows() && N-1 < matrixDP.getCols()) {
-            double val = matrixDP.getElement(k, N-1);
+        // Dernière colonne de la DP (N - 1, ou le dernier point de l'ensemble réduit)
+        if (k < matrixDP.getRows()) {
+            double val = matrixDP.getElement(k, matrixDP.getCols() - 1);
             if (val == std::numeric_limits<double>::max()) {
                 std::cout << "avec " << k + 1 << " clusters = ∞" << sep;
             } else {
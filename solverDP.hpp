@@ -1,10 +1,163 @@
 #pragma once
+#include <chrono>
+#include <atomic>
+#include <functional>
+#include <map>
 #include "matrixDouble.hpp"
+#include "distanceMatrix.hpp"
+#include "intervalCostCache.hpp"
+#include "memoryPolicy.hpp"
+#include "rowSpill.hpp"
+#include "checkpoint.hpp"
+#include "assignmentIndex.hpp"
+#include "solveControl.hpp"
 #include "solverInterval.hpp"
 
+// Dernière mise à jour incrémentale : cases DP recalculées contre un solve complet
+struct UpdateStats {
+    size_t firstChanged;     // Premier indice trié modifié
+    size_t recomputedCells;
+    size_t fullCells;
+};
+
+// Démarrage à chaud : coûts exacts évalués dans les fenêtres et hors fenêtre (certificat en échec)
+struct WarmStartStats {
+    size_t cells;
+    size_t windowCosts;
+    size_t boundChecks;
+    size_t widenedCosts;
+    size_t widenedCells;
+    size_t fullCosts;    // Coûts évalués par un remplissage complet
+};
+
+// Réduction des points avant la DP : points dominés supprimés, doublons regroupés
+struct ReductionStats {
+    size_t originalPoints;
+    size_t dominated;
+    size_t duplicates;
+    size_t reducedPoints;   // Colonnes de la DP
+};
+
+// Statistiques du dernier solve
+struct SolverStats {
+    double fillSeconds;
+    DistanceMatrix::Precision distancePrecision;
+    IntervalCostCache::Stats costCache;
+    MemoryPolicy memoryPolicy;    // Politique demandée
+    AllocationReport dpTable;     // Ce qui a été obtenu pour chaque tampon
+    AllocationReport bandCosts;
+    AllocationReport distances;
+    AllocationReport points;
+    bool outOfCore;               // Lignes DP déversées sur disque
+    size_t estimatedFootprint;
+    size_t spilledBytes;
+};
+
 class SolverDP : public SolverInterval {
 public:
+    SolverDP() : maxClusterLength(0), minClusterLength(1),
+                 distanceBudget(0), allowFloatDistances(true), costCacheEntries(0),
+                 tiledFill(false), columnTile(0), splitTile(0), fillSeconds(0.0),
+                 wavefrontFill(false), wavefrontColumns(0),
+                 mixedPrecision(false), mixedPrecisionCost(0.0),
+                 memoryBudget(0), scratchDirectory("."), outOfCore(false), spilledBytes(0),
+                 checkpointSeconds(60.0), firstFillRow(1), resumedRows(0), resumeAccepted(false),
+                 firstFillColumn(0), updateStats{0, 0, 0}, reusedRows(0),
+                 warmStart(false), warmWindow(16), warmStats{0, 0, 0, 0, 0, 0},
+                 removeDominated(false), collapseDuplicates(false), reductionStats{0, 0, 0, 0},
+                 anytime(false), cancelToken(nullptr), stopFill(false), rowsCompleted(0), bandComplete(false),
+                 outcome{true, false, false, 0, 0, true, 0.0} {}
+
     void solve();
+
+    // Solve borné : le remplissage s'arrête avant la ligne qui dépasserait deadline (débit mesuré) ou dès
+    // l'annulation de token, et rend alors la meilleure solution de repli à K clusters, marquée non optimale
+    SolveOutcome solveWithin(std::chrono::steady_clock::time_point deadline,
+                             const CancellationToken* token = nullptr, ProgressCallback progress = nullptr);
+    const SolveOutcome& getSolveOutcome() const { return outcome; }
+
+    // Borne la taille des clusters à [minLength, maxLength] (maxLength = 0 : pas de borne)
+    void setClusterLengthBounds(uint maxLength, uint minLength = 1);
+    uint getMaxClusterLength() const;
+    uint getMinClusterLength() const { return minClusterLength; }
+
+    // Précalcul des distances si la matrice compactée tient dans le budget (0 : désactivé)
+    void setDistanceMatrixBudget(size_t bytes, bool allowFloat = true);
+    DistanceMatrix::Precision getDistancePrecision() const { return d.getPrecision(); }
+
+    // Mémoïsation paresseuse des coûts d'intervalle, au plus maxEntries entrées (0 : désactivée)
+    void setCostCacheCapacity(size_t maxEntries) { costCacheEntries = maxEntries; }
+    IntervalCostCache::Stats getCostCacheStats() const { return costCache.getStats(); }
+
+    // Remplissage par tuiles (blocs de colonnes x blocs de splits), tailles 0 : déduites des caches
+    void setFillTiling(bool enabled, uint columnTileSize = 0, uint splitTileSize = 0);
+    double getFillSeconds() const { return fillSeconds; }
+    // Appelés juste avant et juste après le remplissage de la table DP (compteurs matériels limités à cette phase)
+    void setFillHooks(std::function<void()> onStart, std::function<void()> onEnd) {
+        fillStartHook = std::move(onStart);
+        fillEndHook = std::move(onEnd);
+    }
+
+    // Remplissage en pipeline : une ligne avance dès que les blocs de colonnes correspondants de la ligne
+    // précédente sont terminés, sans barrière entre les lignes (columnBlock = 0 : taille déduite)
+    void setWavefrontFill(bool enabled, uint columnBlock = 0) { wavefrontFill = enabled; wavefrontColumns = columnBlock; }
+
+    // Coordonnées, distances et coûts d'intervalle en float (sommes compensées),
+    // coût final recalculé exactement en double
+    void setMixedPrecision(bool enabled) { mixedPrecision = enabled; }
+    double getMixedPrecisionCost() const { return mixedPrecisionCost; }
+    double getMixedPrecisionDelta() const { return mixedPrecisionCost - solutionCost; }
+
+    // Placement NUMA et pages énormes de la table DP, de la bande de coûts, des distances et des points
+    void setMemoryPolicy(const MemoryPolicy& policy) { memoryPolicy = policy; }
+    const MemoryPolicy& getMemoryPolicy() const { return memoryPolicy; }
+
+    // Au-delà de bytes d'empreinte estimée, seules deux lignes DP restent en mémoire et les lignes
+    // terminées (coûts et argmin) sont déversées dans un fichier temporaire de directory (0 : pas de budget)
+    void setMemoryBudget(size_t bytes, const string& directory = ".");
+    size_t estimateFootprint() const;
+    bool isOutOfCore() const { return outOfCore; }
+
+    // Écrit périodiquement (toutes les intervalSeconds) les lignes DP terminées dans path, en arrière-plan
+    void setCheckpoint(const string& path, double intervalSeconds = 60.0);
+    // Résout en reprenant après la dernière ligne complète de path ; false si le point de reprise est rejeté
+    bool resume(const string& path);
+    uint getResumedRows() const { return resumedRows; }
+
+    // Insère des points et en supprime (indices dans l'ordre trié courant), puis ne recalcule que
+    // les colonnes DP à partir du premier indice modifié
+    bool update(const vector<double>& insertedPoints, const vector<size_t>& removedIndices);
+    UpdateStats getUpdateStats() const { return updateStats; }
+
+    // Résout pour k clusters sur les mêmes points en reprenant la table DP du solve précédent : la ligne r
+    // (r + 1 clusters) ne dépend pas de K, donc k <= lignes calculées ne fait que le backtracking et
+    // un k plus grand ne remplit que les lignes manquantes
+    bool solveForClusters(size_t k);
+    // Lignes DP reprises par le dernier solveForClusters (0 s'il a fait un solve complet)
+    uint getReusedRows() const { return reusedRows; }
+    uint getComputedRows() const { return !outOfCore && matrixDP.getCols() == N ? static_cast<uint>(matrixDP.getRows()) : 0; }
+    // Coût optimal pour 1..getComputedRows() clusters (max() si aucune partition admissible)
+    vector<double> getCostCurve() const;
+
+    // Démarrage à chaud depuis les intervalles d'une solution précédente sur previousN points : la
+    // recherche du split de chaque case est restreinte à ±window autour de la taille attendue du
+    // dernier cluster, puis certifiée par une borne inférieure des coûts hors fenêtre
+    void setWarmStart(const vector<pair<uint, uint>>& previousIntervals, size_t previousN, uint window = 16);
+    void clearWarmStart() { warmStart = false; }
+    WarmStartStats getWarmStartStats() const { return warmStats; }
+
+    // Avant la DP, supprime les points dominés (front 2D, deux objectifs à minimiser) et regroupe
+    // les doublons exacts en points pondérés ; les étiquettes sont ensuite rendues à tous les points
+    void setPointReduction(bool removeDominatedPoints, bool collapseDuplicatePoints = true);
+    ReductionStats getReductionStats() const { return reductionStats; }
+
+    SolverStats getStats() const;
+
+    // Indice (ordre trié) du médoïde, ou de la médiane, de chaque intervalle de la solution
+    const vector<size_t>& getIntervalCenters() const { return intervalCenters; }
+    // Index d'affectation de nouveaux points aux clusters de la solution
+    AssignmentIndex buildAssignmentIndex() const;
+
     void printMatrixDP();
     void printFinalCosts(string sep);
     MatrixDouble getMatrix() { return matrixDP; }
@@ -12,15 +165,183 @@ public:
 
 protected:
     MatrixDouble matrixDP;
+    uint maxClusterLength;
+    uint minClusterLength;
+    MatrixDouble bandCosts; // bandCosts[n][t] = coût du cluster de L-t points finissant en n (mode borné, rangé par split)
+    DistanceMatrix d;       // Distances précalculées (métrique du solveur), vide si hors budget
+    size_t distanceBudget;
+    bool allowFloatDistances;
+
+    // Métrique stockée dans d : distance carrée (k-medoids) ou distance (p-median)
+    virtual bool usesSquaredDistance() const { return true; }
+    void prepareDistanceMatrix();
+
+    mutable IntervalCostCache costCache;
+    size_t costCacheEntries;
+
+    bool tiledFill;
+    uint columnTile;
+    uint splitTile;
+    double fillSeconds;
+    std::function<void()> fillStartHook;
+    std::function<void()> fillEndHook;
+    // Début et fin de la phase de remplissage : horloge de fillSeconds et hooks
+    std::chrono::steady_clock::time_point beginFill();
+    void endFill(std::chrono::steady_clock::time_point start);
+    bool wavefrontFill;
+    uint wavefrontColumns;
+
+    // Tampons d'un thread pour le remplissage d'un bloc de colonnes
+    struct BlockBuffers {
+        vector<vector<double>> columnCosts;
+        vector<const double*> costs;
+        vector<double> bestCost;
+        BlockBuffers(size_t columns, size_t costLength)
+                : columnCosts(columns, vector<double>(costLength)), costs(columns), bestCost(columns) {}
+    };
+    void fillBlock(uint k, uint n0, uint n1, size_t costLength, uint splits, BlockBuffers& buffers);
+    void fillDPMatrixWavefront(size_t costLength);
+
+    bool mixedPrecision;
+    vector<float> pointsFloat;  // Copie float des points triés (précision mixte)
+    double mixedPrecisionCost;  // Coût de la DP en précision mixte, avant recalcul exact
+
+    MemoryPolicy memoryPolicy;
+    AllocationReport pointsAllocation;
+    void applyPointsPolicy();
+
+    size_t memoryBudget;
+    string scratchDirectory;
+    bool outOfCore;
+    size_t spilledBytes;
+    RowSpillFile spill;
+    void initializeRowRing();
+    void fillDPMatrixOutOfCore(vector<double>& v);
+    void buildSolutionFromSpill();
+
+    string checkpointPath;
+    double checkpointSeconds;
+    string resumePath;
+    DPCheckpoint checkpoint;
+    std::chrono::steady_clock::time_point lastCheckpoint;
+    uint firstFillRow;  // Première ligne à remplir (1, ou la suite d'une reprise)
+    uint resumedRows;
+    bool resumeAccepted;
+    DPCheckpoint::Metadata checkpointMetadata() const;
+    bool restoreCheckpoint();
+    void startCheckpoint();
+    void checkpointAfterRow(uint k);
+
+    uint firstFillColumn;  // Colonnes [0, firstFillColumn) conservées (mise à jour incrémentale)
+    UpdateStats updateStats;
+    size_t fullSolveCells() const;
+
+    // Solutions déjà reconstruites par solveForClusters sur la table DP courante, par nombre de clusters :
+    // une nouvelle demande du même k ne refait ni le backtracking ni le calcul des centres (vidé à chaque
+    // remplissage)
+    struct ClusterSolution {
+        vector<pair<uint, uint>> intervals;
+        vector<size_t> centers;
+        double cost;
+    };
+    std::map<size_t, ClusterSolution> clusterSolutions;
+    uint reusedRows;
+
+    bool warmStart;
+    uint warmWindow;
+    vector<double> warmLengths;   // Taille relative (fraction de N) de chaque cluster précédent
+    WarmStartStats warmStats;
+    vector<double> prefixSums;    // Sommes préfixes des coordonnées ((N+1) x D)
+    vector<double> prefixSquares; // Sommes préfixes des normes carrées
+    vector<double> prefixAbsFirst; // Sommes préfixes de |x_0| (marge d'arrondi)
+    void computePrefixSums();
+    double clusterCostLowerBound(uint start, uint end) const;
+    uint expectedLastClusterLength(uint k) const;
+    void fillDPMatrixWarm(size_t costLength);
+
+    bool removeDominated;
+    bool collapseDuplicates;
+    ReductionStats reductionStats;
+    vector<double> weights;        // Multiplicité de chaque point de la DP (vide : tous de poids 1)
+    vector<double> fullPoints;     // Points triés avant réduction (vide : pas de réduction en cours)
+    vector<size_t> reducedIndex;   // Point de la DP représentant chaque point de fullPoints (npos : dominé)
+    vector<double> prefixWeights;  // Sommes préfixes des poids (démarrage à chaud pondéré)
+    bool reducePoints();
+    void restoreFullPoints();
+    void expandReducedSolution();
+
+    bool anytime;                                   // Solve en cours lancé par solveWithin
+    std::chrono::steady_clock::time_point deadline;
+    const CancellationToken* cancelToken;
+    ProgressCallback progressCallback;
+    std::chrono::steady_clock::time_point fillStartTime;
+    std::atomic<bool> stopFill;                     // Échéance prévue dépassée : les cases restantes sont sautées
+    uint rowsCompleted;                             // Lignes [0, rowsCompleted) complètes
+    bool bandComplete;                              // Bande de coûts remplie avant l'arrêt (prix du repli)
+    SolveOutcome outcome;
+    void afterRow(uint k);
+    void buildFallbackSolution();
+    size_t rowCells(uint k) const { return k < N ? N - std::max(k, firstFillColumn) : 0; }
+
+    // Lu à chaque case : deux lectures relâchées, toujours faux hors solveWithin
+    inline bool fillStopped() const {
+        return stopFill.load(std::memory_order_relaxed) || (cancelToken && cancelToken->isCancelled());
+    }
+
+    // Solve borné : lit l'horloge et arrête le remplissage à l'échéance, puis renvoie fillStopped().
+    // Appelé par coût de cluster et par bloc de colonnes ; la variante à tick (indice de case) ne lit
+    // l'horloge qu'une case sur DEADLINE_STRIDE
+    static const uint DEADLINE_STRIDE = 64;
+    inline bool fillInterrupted() {
+        if (anytime && std::chrono::steady_clock::now() >= deadline) stopFill.store(true);
+        return fillStopped();
+    }
+    inline bool fillInterrupted(uint tick) {
+        return tick % DEADLINE_STRIDE == 0 ? fillInterrupted() : fillStopped();
+    }
+
+    inline double pointWeight(size_t i) const {
+        return weights.empty() ? 1.0 : weights[i];
+    }
+
+    inline float squaredDistanceFloat(size_t i, size_t j) const {
+        float result = 0.0f;
+        for (size_t dim = 0; dim < D; ++dim) {
+            float diff = pointsFloat[D * i + dim] - pointsFloat[D * j + dim];
+            result += diff * diff;
+        }
+        return result;
+    }
+
+    double calculateClusterCostFloat(uint start, uint end) const;
+    double exactClusterCost(uint start, uint end) const;
+    size_t exactClusterCenter(uint start, uint end, double& cost) const;
+
+    vector<size_t> intervalCenters;
+    void computeIntervalCenters();
+    void recheckSolutionCost();
+
+    // Faux pour une sous-classe à remplissage propre : solveWithin, update et solveForClusters, qui passent
+    // par le remplissage générique, refusent alors de résoudre (genericFillAvailable)
+    virtual bool supportsGenericFill() const { return true; }
+    bool genericFillAvailable(const char* entry) const;
 
     void fillFirstLine(vector<double>& v);
     virtual void clusterCostsBefore(uint i, vector<double>& v) = 0;
     virtual void clusterCostsFromBeginning(vector<double>& v) = 0;
+    virtual double calculateClusterCost(uint start, uint end) const = 0;
+
+    double clusterCost(uint start, uint end) const;
 
     bool validateInputs();
+    bool isLengthBounded() const { return getMaxClusterLength() < N; }
+    void fillBandCosts();
+    const double* costsEndingAt(uint n, vector<double>& buffer);
     void initializeMatrix();
     void fillDPMatrix(vector<double>& v);
-    void buildSolutionFromMatrix();
+    void fillDPMatrixTiled(size_t costLength);
+    void resolveTileSizes(uint& columns, uint& splits) const;
+    void buildSolutionFromMatrix(uint lastRow);
     void calculateFinalCost();
     bool isMatrixAvailable();
 
@@ -30,5 +351,16 @@ protected:
         bool isValid;
     };
 
-    OptimalSplit findOptimalSplit(uint k, uint n, const vector<double>& v);
+    // Splits admissibles [first, end) pour la cellule (k, n) avec des vecteurs de coûts de taille costLength
+    bool splitWindow(uint k, uint n, size_t costLength, uint& first, uint& end) const;
+
+    // v : coûts des clusters finissant en n rangés par split, v[t] = coût du cluster de costLength-t points
+    OptimalSplit findOptimalSplit(uint k, uint n, const double* v, size_t costLength);
+    OptimalSplit findOptimalSplit(const MatrixDouble& dp, uint k, uint n, const double* v, size_t costLength) const {
+        return findOptimalSplit(dp.getRow(k-1), k, n, v, costLength);
+    }
+    OptimalSplit findOptimalSplit(const double* previousRow, uint k, uint n, const double* v, size_t costLength) const;
+    OptimalSplit findOptimalSplit(const MatrixDouble& dp, uint k, uint n, const vector<double>& v) const {
+        return findOptimalSplit(dp, k, n, v.data(), v.size());
+    }
 };
\ No newline at end of file
@@ -3,10 +3,15 @@
 #include <numeric>
 
 void SolverInterval::computeSolutionFromIntervals() {
+    computeSolutionFromIntervals(solutionInterval, solution);
+}
+
+void SolverInterval::computeSolutionFromIntervals(const vector<pair<uint, uint>>& intervals,
+                                                  vector<size_t>& labels) const {
     uint compt = 1;
-    for (auto it = solutionInterval.begin(); it != solutionInterval.end(); ++it) {
+    for (auto it = intervals.begin(); it != intervals.end(); ++it) {
         for (uint i = it->first; i <= it->second; i++) {
-            solution.at(i) = compt;
+            labels.at(i) = compt;
         }
         compt++;
     }
@@ -5,10 +5,15 @@
 typedef unsigned int uint;
 
 class SolverInterval : public Solver {
+public:
+    // Clusters [début, fin] dans l'ordre trié des points
+    const vector<pair<uint, uint>>& getSolutionIntervals() const { return solutionInterval; }
+
 protected:
     vector<pair<uint, uint>> solutionInterval;
 
     void computeSolutionFromIntervals();
+    void computeSolutionFromIntervals(const vector<pair<uint, uint>>& intervals, vector<size_t>& labels) const;
     bool checkIsSorted();
     void resort();
 };
\ No newline at end of file
@@ -0,0 +1,140 @@
+#include "solverPool.hpp"
+#include <algorithm>
+#include <memory>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+// Pool et réservation du travail exécuté par le thread courant
+thread_local SolverPool* currentPool = nullptr;
+thread_local size_t* currentReserved = nullptr;
+
+}
+
+SolverPool::SolverPool(size_t workers) : stopping(false), running(0) {
+#ifdef _OPENMP
+    threadBudget = static_cast<size_t>(omp_get_max_threads());
+#else
+    threadBudget = std::max<size_t>(1, std::thread::hardware_concurrency());
+#endif
+    freeThreads = threadBudget;
+
+    size_t count = workers > 0 ? workers : threadBudget;
+    for (size_t i = 0; i < count; i++) {
+        threads.emplace_back(&SolverPool::workerLoop, this);
+    }
+}
+
+/**
+ * Finishes the queued jobs, then joins the workers
+ */
+SolverPool::~SolverPool() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    available.notify_all();
+    for (std::thread& thread : threads) thread.join();
+}
+
+std::future<void> SolverPool::submit(std::function<void()> job) {
+    auto task = std::make_shared<std::packaged_task<void()>>(std::move(job));
+    std::future<void> result = task->get_future();
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        queue.push_back([task]() { (*task)(); });
+    }
+    available.notify_one();
+    return result;
+}
+
+SolverPool& SolverPool::shared(size_t workers) {
+    static SolverPool* pool = new SolverPool(workers);
+    return *pool;
+}
+
+void SolverPool::workerLoop() {
+    while (true) {
+        std::function<void()> job;
+        size_t team, reserved;
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            available.wait(guard, [this]() { return stopping || !queue.empty(); });
+            if (queue.empty()) return;
+            job = std::move(queue.front());
+            queue.pop_front();
+            team = claimThreads(reserved);
+        }
+
+#ifdef _OPENMP
+        // Taille des équipes des régions parallèles lancées par ce thread
+        omp_set_num_threads(static_cast<int>(team));
+#else
+        (void)team;
+#endif
+        currentPool = this;
+        currentReserved = &reserved;
+        job();
+        currentPool = nullptr;
+        currentReserved = nullptr;
+
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            releaseThreads(reserved);
+        }
+    }
+}
+
+/**
+ * Team size of a job that starts now (lock held): the free threads of the
+ * budget are split evenly between this job and the queued jobs that idle
+ * workers will start next (running jobs keep their team). The team is never
+ * smaller than the worker thread itself, which is then not taken from the
+ * budget
+ *
+ * @param reserved Output: threads taken from the budget, given back by releaseThreads
+ */
+size_t SolverPool::claimThreads(size_t& reserved) {
+    running++;
+    size_t starting = 1 + std::min(queue.size(), threads.size() - std::min(running, threads.size()));
+    reserved = freeThreads / starting;
+    freeThreads -= reserved;
+    return std::max<size_t>(1, reserved);
+}
+
+void SolverPool::releaseThreads(size_t reserved) {
+    running--;
+    freeThreads += reserved;
+}
+
+/**
+ * Moves the team of the calling job toward the fair share of the budget
+ * (budget / running jobs): surplus threads go back to the free pool, missing
+ * ones are taken from it when available
+ */
+void SolverPool::rebalance() {
+    if (!currentPool) return;
+#ifdef _OPENMP
+    if (omp_in_parallel()) return;
+#endif
+
+    SolverPool& pool = *currentPool;
+    size_t& reserved = *currentReserved;
+    {
+        std::lock_guard<std::mutex> guard(pool.lock);
+        size_t fair = std::max<size_t>(1, pool.threadBudget / std::max<size_t>(1, pool.running));
+        if (reserved > fair) {
+            pool.freeThreads += reserved - fair;
+            reserved = fair;
+        } else {
+            size_t taken = std::min(fair - reserved, pool.freeThreads);
+            pool.freeThreads -= taken;
+            reserved += taken;
+        }
+    }
+#ifdef _OPENMP
+    omp_set_num_threads(static_cast<int>(std::max<size_t>(1, reserved)));
+#endif
+}
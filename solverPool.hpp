@@ -0,0 +1,54 @@
+#pragma once
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <cstddef>
+
+/**
+ * Pool de threads exécutant des solves indépendants. Les équipes OpenMP des solves
+ * simultanés se partagent un budget de threads (celui d'un solve seul) : au démarrage,
+ * un travail reçoit sa part des threads libres, compte tenu des travaux en cours et en
+ * attente, au lieu de lancer chacun une équipe complète. Entre deux régions parallèles,
+ * un travail peut appeler rebalance() pour ramener son équipe à la part équitable
+ * (rendre des threads quand d'autres travaux ont démarré, en reprendre quand ils finissent).
+ */
+class SolverPool {
+public:
+    // workers = 0 : autant de travaux simultanés que de threads OpenMP (ou de cœurs sans OpenMP)
+    explicit SolverPool(size_t workers = 0);
+    ~SolverPool();
+
+    SolverPool(const SolverPool&) = delete;
+    SolverPool& operator=(const SolverPool&) = delete;
+
+    // Exécute job sur un thread du pool ; une exception de job est relancée par get() sur le futur
+    std::future<void> submit(std::function<void()> job);
+
+    // Point de coopération, sans effet hors d'un travail du pool ou dans une région parallèle
+    static void rebalance();
+
+    size_t getWorkers() const { return threads.size(); }
+    size_t getThreadBudget() const { return threadBudget; }
+
+    // Pool de la bibliothèque, créé au premier appel avec workers (0 : défaut) et jamais détruit :
+    // les travaux encore en cours à la sortie du processus sont abandonnés
+    static SolverPool& shared(size_t workers = 0);
+
+private:
+    std::vector<std::thread> threads;
+    std::mutex lock;
+    std::condition_variable available;
+    std::deque<std::function<void()>> queue;
+    bool stopping;
+    size_t threadBudget;
+    size_t freeThreads;
+    size_t running;
+
+    void workerLoop();
+    size_t claimThreads(size_t& reserved);
+    void releaseThreads(size_t reserved);
+};
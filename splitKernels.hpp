@@ -0,0 +1,126 @@
+#pragma once
+#include <cstddef>
+#include <limits>
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * Noyaux de la recherche du split optimal : min + argmin de a[i] + b[i]
+ * sur deux flux lus en avant, sans branchement dans la boucle principale.
+ */
+
+struct ArgminResult {
+    double value;
+    size_t index;
+};
+
+namespace splitKernels {
+
+const size_t LANES = 4;
+
+// Fusion des voies : plus petite valeur, puis plus petit indice à égalité
+inline void mergeLanes(const double* laneValue, const double* laneIndex, ArgminResult& result) {
+    for (size_t l = 0; l < LANES; l++) {
+        size_t index = static_cast<size_t>(laneIndex[l]);
+        if (laneValue[l] < result.value || (laneValue[l] == result.value && index < result.index)) {
+            result.value = laneValue[l];
+            result.index = index;
+        }
+    }
+}
+
+}
+
+/**
+ * Returns the minimum of a[i] + b[i] over [0, len) and its index. Each SIMD lane
+ * keeps its own (min, argmin) pair with strict comparison, so the earliest
+ * index wins within a lane; lanes are merged by (value, index), which makes
+ * the tie-break deterministic: the smallest index among equal minima.
+ * Indices are carried as doubles (exact up to 2^53) so that the selects work
+ * on vectors of the same width as the costs
+ *
+ * @param a First stream (DP row k-1 from the first split)
+ * @param b Second stream (split-ordered cluster costs from the first split)
+ * @param len Number of candidate splits
+ * @return Minimum sum (max() if len == 0) and its index
+ */
+inline ArgminResult argminSum(const double* a, const double* b, size_t len) {
+    using splitKernels::LANES;
+
+    double laneValue[LANES];
+    double laneIndex[LANES];
+    size_t blocked = len - len % LANES;
+
+#if defined(__AVX__)
+    __m256d bestValue = _mm256_set1_pd(std::numeric_limits<double>::max());
+    __m256d bestIndex = _mm256_setzero_pd();
+    __m256d index = _mm256_set_pd(3.0, 2.0, 1.0, 0.0);
+    const __m256d step = _mm256_set1_pd(static_cast<double>(LANES));
+
+    for (size_t i = 0; i < blocked; i += LANES) {
+        __m256d sum = _mm256_add_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i));
+        __m256d better = _mm256_cmp_pd(sum, bestValue, _CMP_LT_OQ);
+        bestValue = _mm256_blendv_pd(bestValue, sum, better);
+        bestIndex = _mm256_blendv_pd(bestIndex, index, better);
+        index = _mm256_add_pd(index, step);
+    }
+
+    _mm256_storeu_pd(laneValue, bestValue);
+    _mm256_storeu_pd(laneIndex, bestIndex);
+#elif defined(__SSE2__)
+    __m128d bestValue0 = _mm_set1_pd(std::numeric_limits<double>::max());
+    __m128d bestValue1 = bestValue0;
+    __m128d bestIndex0 = _mm_setzero_pd();
+    __m128d bestIndex1 = _mm_setzero_pd();
+    __m128d index0 = _mm_set_pd(1.0, 0.0);
+    __m128d index1 = _mm_set_pd(3.0, 2.0);
+    const __m128d step = _mm_set1_pd(static_cast<double>(LANES));
+
+    for (size_t i = 0; i < blocked; i += LANES) {
+        __m128d sum0 = _mm_add_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i));
+        __m128d sum1 = _mm_add_pd(_mm_loadu_pd(a + i + 2), _mm_loadu_pd(b + i + 2));
+        __m128d better0 = _mm_cmplt_pd(sum0, bestValue0);
+        __m128d better1 = _mm_cmplt_pd(sum1, bestValue1);
+        bestValue0 = _mm_or_pd(_mm_and_pd(better0, sum0), _mm_andnot_pd(better0, bestValue0));
+        bestValue1 = _mm_or_pd(_mm_and_pd(better1, sum1), _mm_andnot_pd(better1, bestValue1));
+        bestIndex0 = _mm_or_pd(_mm_and_pd(better0, index0), _mm_andnot_pd(better0, bestIndex0));
+        bestIndex1 = _mm_or_pd(_mm_and_pd(better1, index1), _mm_andnot_pd(better1, bestIndex1));
+        index0 = _mm_add_pd(index0, step);
+        index1 = _mm_add_pd(index1, step);
+    }
+
+    _mm_storeu_pd(laneValue, bestValue0);
+    _mm_storeu_pd(laneValue + 2, bestValue1);
+    _mm_storeu_pd(laneIndex, bestIndex0);
+    _mm_storeu_pd(laneIndex + 2, bestIndex1);
+#else
+    for (size_t l = 0; l < LANES; l++) {
+        laneValue[l] = std::numeric_limits<double>::max();
+        laneIndex[l] = 0.0;
+    }
+
+    for (size_t i = 0; i < blocked; i += LANES) {
+        for (size_t l = 0; l < LANES; l++) {
+            double sum = a[i + l] + b[i + l];
+            bool better = sum < laneValue[l];
+            laneValue[l] = better ? sum : laneValue[l];
+            laneIndex[l] = better ? static_cast<double>(i + l) : laneIndex[l];
+        }
+    }
+#endif
+
+    ArgminResult result{std::numeric_limits<double>::max(), 0};
+    splitKernels::mergeLanes(laneValue, laneIndex, result);
+
+    // Reste : indices plus grands que ceux des voies, l'égalité ne les retient pas
+    for (size_t i = blocked; i < len; i++) {
+        double sum = a[i] + b[i];
+        if (sum < result.value) {
+            result.value = sum;
+            result.index = i;
+        }
+    }
+
+    return result;
+}
@@ -2,12 +2,57 @@
 #include <vector>
 #include <string>
 #include <fstream>
+#include <sstream>
 #include <filesystem>
 #include <iomanip>
 #include <map>
 #include <algorithm>
+#include <cmath>
+#include <limits>
+#include <initializer_list>
+#include <random>
+#include <cstdio>
+#include <thread>
+#include <future>
+#include <memory>
+#include <atomic>
+#include <ctime>
+#include <cctype>
+#include <stdexcept>
+#include <functional>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#include "fusedDP.hpp"
 #include "medoidsDP.hpp"
 #include "medianDP.hpp"
+#include "coresetDP.hpp"
+#include "fasterPAM.hpp"
+#include "kmeansDP.hpp"
+#include "kcenter.hpp"
+#include "clusteringApi.hpp"
+#include "solverPool.hpp"
+#include "frontGenerator.hpp"
+#include "splitKernels.hpp"
+#include <chrono>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Budget mémoire pour la matrice des distances précalculée (512 Mo)
+const size_t DISTANCE_MATRIX_BUDGET = size_t(512) << 20;
+
+// Instances et valeurs de K du benchmark par défaut et de --record
+const std::vector<std::string> DEFAULT_INSTANCES = {
+        "data/very_small_instance_3.txt",
+        "data/very_small_instance_2.txt",
+        "data/very_small_instance_4.csv",
+        "data/very_small_instance_1.txt"
+};
+const std::vector<size_t> DEFAULT_K_VALUES = {2, 3, 4, 5};
 
 struct BenchmarkResult {
     std::string instance_name;
@@ -19,155 +64,2379 @@ struct BenchmarkResult {
     double median_on_median;    // Solution médian évaluée sur critère médian
 };
 
-class BenchmarkSuite {
-private:
-    std::vector<std::string> instance_files;
-    std::vector<size_t> K_values;
-    std::vector<BenchmarkResult> results;
+// Temps d'un solve FusedDP (instance, K) sur plusieurs répétitions : base de référence des performances
+struct TimingResult {
+    std::string instance_file;
+    std::string instance_name;
+    size_t N;
+    size_t K;
+    std::vector<double> seconds;
+};
+
+// Coupe std::cout pendant sa durée de vie : les traces des solveurs fausseraient les temps mesurés
+// (tampon qui ignore tout plutôt qu'un flux en erreur : les écritures simultanées des travaux du pool restent sûres)
+class QuietOutput {
+private:
+    class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int c) override { return c; }
+    };
+    NullBuffer silent;
+    std::streambuf* saved;
+
+public:
+    QuietOutput() : saved(std::cout.rdbuf(&silent)) {}
+    ~QuietOutput() { std::cout.rdbuf(saved); }
+};
+
+// Quantile q de valeurs triées (interpolation linéaire)
+double quantile(const std::vector<double>& sorted, double q) {
+    if (sorted.empty()) return 0.0;
+    double position = q * (sorted.size() - 1);
+    size_t below = static_cast<size_t>(position);
+    size_t above = std::min(below + 1, sorted.size() - 1);
+    return sorted[below] + (position - below) * (sorted[above] - sorted[below]);
+}
+
+// Première ligne de la sortie d'une commande, "" si elle échoue
+std::string commandOutput(const std::string& command) {
+    std::string line;
+#ifdef __linux__
+    FILE* pipe = popen(command.c_str(), "r");
+    if (!pipe) return line;
+    char buffer[256];
+    if (fgets(buffer, sizeof(buffer), pipe)) line = buffer;
+    pclose(pipe);
+    while (!line.empty() && (line.back() == '\n' || line.back() == '\r')) line.pop_back();
+#endif
+    return line;
+}
+
+// Machine et version mesurées : enregistrées avec la base de référence et comparées par --compare
+std::vector<std::pair<std::string, std::string>> runMetadata() {
+    std::string commit = commandOutput("git rev-parse --short HEAD 2>/dev/null");
+    if (commit.empty()) commit = "inconnu";
+    else if (!commandOutput("git status --porcelain --untracked-files=no 2>/dev/null").empty()) commit += "-dirty";
+
+    std::string cpu = commandOutput("grep -m1 'model name' /proc/cpuinfo 2>/dev/null | cut -d: -f2- | sed 's/^ *//'");
+    int threads = 1;
+#ifdef _OPENMP
+    threads = omp_get_max_threads();
+#endif
+    std::time_t now = std::time(nullptr);
+    char date[32];
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    return {{"commit", commit},
+            {"date", date},
+            {"machine", commandOutput("uname -n 2>/dev/null")},
+            {"cpu", cpu.empty() ? "inconnu" : cpu},
+            {"threads", std::to_string(threads)},
+            {"compiler", __VERSION__}};
+}
+
+// Fichiers .txt d'un répertoire, triés
+std::vector<std::string> listInstances(const std::string& data_dir) {
+    std::vector<std::string> instances;
+    for (const auto& entry : std::filesystem::directory_iterator(data_dir)) {
+        if (entry.path().extension() == ".txt") {
+            instances.push_back(entry.path().string());
+        }
+    }
+    std::sort(instances.begin(), instances.end());
+    return instances;
+}
+
+// Nom d'une instance : fichier sans répertoire ni extension
+std::string instanceName(const std::string& instance_file) {
+    return std::filesystem::path(instance_file).stem().string();
+}
+
+// Secondes écoulées depuis start
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Taille de cluster maximale des benchmarks en mode borné : length_bound, ou 4 N / K (arrondi au-dessus) s'il est nul
+size_t boundedLength(size_t N, size_t K, size_t length_bound) {
+    return length_bound > 0 ? length_bound : (4 * N + K - 1) / K;
+}
+
+// Mode borné à L avec la matrice des distances, remplissage par tuiles sauf si tiled est faux
+void configureBounded(SolverDP& solver, size_t L, bool tiled = true) {
+    solver.setDistanceMatrixBudget(DISTANCE_MATRIX_BUDGET);
+    solver.setClusterLengthBounds(static_cast<uint>(L));
+    solver.setFillTiling(tiled);
+}
+
+// Benchmark lancé par un mode de la ligne de commande : run() mesure, writeResults() écrit le CSV,
+// printSummary() affiche le résumé
+class Benchmark {
+public:
+    virtual ~Benchmark() = default;
+
+    virtual void run() = 0;
+    virtual void printSummary() = 0;
+
+    // false si le fichier ne peut pas être créé
+    bool exportResults(const std::string& output_file) {
+        std::ofstream file(output_file);
+        if (!file.is_open()) {
+            std::cerr << "Erreur: impossible de créer " << output_file << std::endl;
+            return false;
+        }
+        writeResults(file);
+        file.close();
+        std::cout << "✓ Résultats exportés: " << output_file << std::endl;
+        return true;
+    }
+
+protected:
+    virtual void writeResults(std::ostream& file) = 0;
+
+    // Applique body à chaque instance ; l'échec d'une instance est signalé sans arrêter les suivantes
+    static void forEachInstance(const std::vector<std::string>& instance_files,
+                                const std::function<void(const std::string&)>& body) {
+        for (const std::string& instance_file : instance_files) {
+            try {
+                body(instance_file);
+            } catch (const std::exception& e) {
+                std::cerr << "  ✗ Error: " << e.what() << std::endl;
+            }
+        }
+    }
+};
+
+// Benchmark à un résultat par instance (ou par configuration) : run() remplit results, la sous-classe ne décrit que
+// l'en-tête du CSV, une ligne du CSV et une ligne du résumé
+template <typename Result>
+class ResultTableBenchmark : public Benchmark {
+public:
+    void printSummary() override {
+        std::cout << "\n=== " << summaryTitle() << " ===" << std::endl;
+        for (const Result& result : results) printResult(result);
+    }
+
+protected:
+    std::vector<Result> results;
+
+    void writeResults(std::ostream& file) override {
+        file << csvHeader() << std::endl;
+        for (const Result& result : results) writeResult(file, result);
+    }
+
+    virtual std::string csvHeader() const = 0;
+    virtual void writeResult(std::ostream& file, const Result& result) const = 0;  // Terminée par std::endl
+    virtual std::string summaryTitle() const = 0;
+    virtual void printResult(const Result& result) const = 0;                      // Terminée par std::endl
+};
+
+// Compteur matériel de défauts de cache (perf_event, Linux), inactif si indisponible.
+// Les threads OpenMP existants ne sont pas comptés : lancer avec OMP_NUM_THREADS=1 pour un décompte complet.
+class CacheMissCounter {
+private:
+    int fd;
+
+public:
+    CacheMissCounter() : fd(-1) {
+#ifdef __linux__
+        perf_event_attr attr{};
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.inherit = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    ~CacheMissCounter() {
+#ifdef __linux__
+        if (fd >= 0) close(fd);
+#endif
+    }
+
+    bool isAvailable() const { return fd >= 0; }
+
+    void start() {
+#ifdef __linux__
+        if (fd < 0) return;
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    }
+
+    long long stop() {
+        long long count = -1;
+#ifdef __linux__
+        if (fd < 0) return -1;
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(fd, &count, sizeof(count)) != sizeof(count)) count = -1;
+#endif
+        return count;
+    }
+};
+
+struct FillTilingResult {
+    std::string instance_name;
+    size_t N;
+    size_t K;
+    size_t L;
+    double fill_seconds_plain;
+    double fill_seconds_tiled;
+    double fill_seconds_wavefront; // Tuiles + lignes en pipeline
+    long long cache_misses_plain;  // -1 si compteur indisponible
+    long long cache_misses_tiled;
+    bool same_cost;
+};
+
+// Compare le remplissage DP colonne par colonne et le remplissage par tuiles
+// puis le remplissage par tuiles avec les lignes en pipeline
+// (même instance, même mode borné, donc mêmes coûts d'intervalle)
+class FillTilingBenchmark : public ResultTableBenchmark<FillTilingResult> {
+private:
+    std::vector<std::string> instance_files;
+    size_t length_bound; // 0 : 4 * N / K
+
+    double solveOnce(const std::string& instance_file, bool tiled, bool wavefront, size_t L,
+                     CacheMissCounter& counter, long long& misses, double& cost) {
+        MedoidsDP solver;
+        solver.import(instance_file);
+        solver.setNbClusters();
+        configureBounded(solver, L, tiled);
+        solver.setWavefrontFill(wavefront);
+
+        // Défauts de cache du seul remplissage (ni lecture, ni distances, ni backtracking)
+        misses = -1;
+        solver.setFillHooks([&counter]() { counter.start(); }, [&counter, &misses]() { misses = counter.stop(); });
+        {
+            QuietOutput quiet;
+            solver.solve();
+        }
+
+        cost = solver.getSolutionCost();
+        return solver.getFillSeconds();
+    }
+
+public:
+    FillTilingBenchmark(const std::vector<std::string>& instances, size_t L)
+            : instance_files(instances), length_bound(L) {}
+
+    void run() override {
+        CacheMissCounter counter;
+        if (!counter.isAvailable()) {
+            std::cout << "Compteur de défauts de cache indisponible, seuls les temps sont mesurés" << std::endl;
+        }
+
+        forEachInstance(instance_files, [&](const std::string& instance_file) {
+            MedoidsDP probe;
+            probe.import(instance_file);
+            probe.setNbClusters();
+
+            FillTilingResult result;
+            result.instance_name = instanceName(instance_file);
+            result.N = probe.getNbPoints();
+            result.K = probe.getNbClusters();
+            result.L = boundedLength(result.N, result.K, length_bound);
+
+            double cost_plain, cost_tiled, cost_wavefront;
+            long long misses_wavefront;
+            result.fill_seconds_plain = solveOnce(instance_file, false, false, result.L, counter,
+                                                  result.cache_misses_plain, cost_plain);
+            result.fill_seconds_tiled = solveOnce(instance_file, true, false, result.L, counter,
+                                                  result.cache_misses_tiled, cost_tiled);
+            result.fill_seconds_wavefront = solveOnce(instance_file, true, true, result.L, counter,
+                                                      misses_wavefront, cost_wavefront);
+            result.same_cost = (cost_plain == cost_tiled && cost_plain == cost_wavefront);
+
+            results.push_back(result);
+        });
+    }
+
+    std::string csvHeader() const override {
+        return "instance,N,K,L,fill_seconds_plain,fill_seconds_tiled,speedup,"
+               "fill_seconds_wavefront,speedup_wavefront,cache_misses_plain,cache_misses_tiled,same_cost";
+    }
+
+    void writeResult(std::ostream& file, const FillTilingResult& result) const override {
+        file << result.instance_name << ","
+             << result.N << ","
+             << result.K << ","
+             << result.L << ","
+             << std::fixed << std::setprecision(6)
+             << result.fill_seconds_plain << ","
+             << result.fill_seconds_tiled << ","
+             << result.fill_seconds_plain / result.fill_seconds_tiled << ","
+             << result.fill_seconds_wavefront << ","
+             << result.fill_seconds_plain / result.fill_seconds_wavefront << ","
+             << result.cache_misses_plain << ","
+             << result.cache_misses_tiled << ","
+             << (result.same_cost ? 1 : 0) << std::endl;
+    }
+
+    std::string summaryTitle() const override { return "REMPLISSAGE DP PAR TUILES"; }
+
+    void printResult(const FillTilingResult& result) const override {
+        std::cout << result.instance_name << " (N=" << result.N << ", K=" << result.K << ", L=" << result.L << "): "
+                  << std::fixed << std::setprecision(3)
+                  << result.fill_seconds_plain << " s -> " << result.fill_seconds_tiled << " s"
+                  << " (pipeline " << result.fill_seconds_wavefront << " s)";
+        if (result.cache_misses_plain >= 0) {
+            std::cout << ", défauts de cache " << result.cache_misses_plain << " -> " << result.cache_misses_tiled;
+        }
+        std::cout << (result.same_cost ? "" : " ✗ coûts différents") << std::endl;
+    }
+};
+
+struct PrecisionResult {
+    std::string instance_name;
+    std::string criterion;
+    size_t N;
+    size_t K;
+    size_t L;
+    double cost_double;        // Optimum de la DP en double
+    double cost_mixed;         // Coût exact (double) de la solution en précision mixte
+    double cost_mixed_dp;      // Coût estimé par la DP en précision mixte
+    double seconds_double;
+    double seconds_mixed;
+};
+
+// Compare la résolution en double et en précision mixte (float + sommes compensées)
+class PrecisionBenchmark : public ResultTableBenchmark<PrecisionResult> {
+private:
+    std::vector<std::string> instance_files;
+    size_t length_bound; // 0 : 4 * N / K
+
+    template <typename SolverType>
+    void compare(const std::string& instance_file, const std::string& criterion) {
+        PrecisionResult result;
+        result.instance_name = instanceName(instance_file);
+        result.criterion = criterion;
+
+        for (int mixed = 0; mixed <= 1; mixed++) {
+            SolverType solver;
+            solver.import(instance_file);
+            solver.setNbClusters();
+            result.N = solver.getNbPoints();
+            result.K = solver.getNbClusters();
+            result.L = boundedLength(result.N, result.K, length_bound);
+
+            configureBounded(solver, result.L);
+            solver.setMixedPrecision(mixed == 1);
+
+            auto start = std::chrono::steady_clock::now();
+            solver.solve();
+            double seconds = secondsSince(start);
+
+            if (mixed == 1) {
+                result.cost_mixed = solver.getSolutionCost();
+                result.cost_mixed_dp = solver.getMixedPrecisionCost();
+                result.seconds_mixed = seconds;
+            } else {
+                result.cost_double = solver.getSolutionCost();
+                result.seconds_double = seconds;
+            }
+        }
+
+        results.push_back(result);
+    }
+
+public:
+    PrecisionBenchmark(const std::vector<std::string>& instances, size_t L)
+            : instance_files(instances), length_bound(L) {}
+
+    void run() override {
+        forEachInstance(instance_files, [&](const std::string& instance_file) {
+            compare<MedoidsDP>(instance_file, "medoids");
+            compare<MedianDP>(instance_file, "median");
+        });
+    }
+
+    std::string csvHeader() const override {
+        return "instance,criterion,N,K,L,cost_double,cost_mixed,cost_mixed_dp,relative_delta,"
+               "seconds_double,seconds_mixed";
+    }
+
+    void writeResult(std::ostream& file, const PrecisionResult& result) const override {
+        file << result.instance_name << ","
+             << result.criterion << ","
+             << result.N << ","
+             << result.K << ","
+             << result.L << ","
+             << std::scientific << std::setprecision(12)
+             << result.cost_double << ","
+             << result.cost_mixed << ","
+             << result.cost_mixed_dp << ","
+             << (result.cost_mixed - result.cost_double) / result.cost_double << ","
+             << std::fixed << std::setprecision(6)
+             << result.seconds_double << ","
+             << result.seconds_mixed << std::endl;
+    }
+
+    std::string summaryTitle() const override { return "PRÉCISION MIXTE"; }
+
+    void printResult(const PrecisionResult& result) const override {
+        std::cout << result.instance_name << " [" << result.criterion << "] (N=" << result.N
+                  << ", K=" << result.K << ", L=" << result.L << "): écart relatif "
+                  << std::scientific << std::setprecision(3)
+                  << (result.cost_mixed - result.cost_double) / result.cost_double
+                  << std::fixed << ", " << result.seconds_double << " s -> " << result.seconds_mixed << " s"
+                  << std::endl;
+    }
+};
+
+struct AssignmentResult {
+    std::string instance_name;
+    size_t N;
+    size_t K;
+    size_t queries;
+    int threads;
+    double seconds_batch;
+    double seconds_scalar;
+    size_t mismatches_training; // Points de l'instance dont l'étiquette diffère de la solution
+};
+
+// Débit de l'affectation de nouveaux points aux clusters appris (AssignmentIndex)
+class AssignmentBenchmark : public ResultTableBenchmark<AssignmentResult> {
+private:
+    std::vector<std::string> instance_files;
+    size_t num_queries;
+
+public:
+    AssignmentBenchmark(const std::vector<std::string>& instances, size_t queries)
+            : instance_files(instances), num_queries(queries) {}
+
+    void run() override {
+        forEachInstance(instance_files, [&](const std::string& instance_file) {
+            MedoidsDP solver;
+            solver.import(instance_file);
+            solver.setNbClusters();
+            size_t N = solver.getNbPoints();
+            size_t K = solver.getNbClusters();
+            configureBounded(solver, boundedLength(N, K, 0));
+            solver.solve();
+
+            AssignmentIndex index = solver.buildAssignmentIndex();
+            const std::vector<double>& points = solver.getPoints();
+            size_t D = solver.getDimension();
+
+            AssignmentResult result;
+            result.instance_name = instanceName(instance_file);
+            result.N = N;
+            result.K = K;
+            result.queries = num_queries;
+#ifdef _OPENMP
+            result.threads = omp_get_max_threads();
+#else
+            result.threads = 1;
+#endif
+
+            std::vector<size_t> labels(N);
+            index.assignBatch(points.data(), N, D, labels.data());
+            result.mismatches_training = 0;
+            for (size_t i = 0; i < N; i++) {
+                if (labels[i] != solver.getSolution()[i]) result.mismatches_training++;
+            }
+
+            // Requêtes uniformes dans la boîte englobante de l'instance
+            double low = points[0], high = points[(N - 1) * D];
+            std::mt19937_64 generator(42);
+            std::uniform_real_distribution<double> uniform(low, high);
+            std::vector<double> queries(num_queries * D);
+            for (double& q : queries) q = uniform(generator);
+            labels.assign(num_queries, 0);
+
+            auto start = std::chrono::steady_clock::now();
+            index.assignBatch(queries.data(), num_queries, D, labels.data());
+            result.seconds_batch = secondsSince(start);
+
+            size_t checksum = 0;
+            start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < num_queries; i++) {
+                checksum += index.assign(&queries[i * D]) == labels[i] ? 0 : 1;
+            }
+            result.seconds_scalar = secondsSince(start);
+            if (checksum != 0) std::cerr << "  ✗ " << checksum << " affectations différentes entre lot et unitaire" << std::endl;
+
+            results.push_back(result);
+        });
+    }
+
+    std::string csvHeader() const override {
+        return "instance,N,K,queries,threads,seconds_batch,seconds_scalar,"
+               "assignments_per_second_per_core,mismatches_training";
+    }
+
+    void writeResult(std::ostream& file, const AssignmentResult& result) const override {
+        file << result.instance_name << ","
+             << result.N << ","
+             << result.K << ","
+             << result.queries << ","
+             << result.threads << ","
+             << std::fixed << std::setprecision(6)
+             << result.seconds_batch << ","
+             << result.seconds_scalar << ","
+             << std::setprecision(0)
+             << result.queries / result.seconds_batch / result.threads << ","
+             << result.mismatches_training << std::endl;
+    }
+
+    std::string summaryTitle() const override { return "AFFECTATION DE NOUVEAUX POINTS"; }
+
+    void printResult(const AssignmentResult& result) const override {
+        std::cout << result.instance_name << " (N=" << result.N << ", K=" << result.K << "): "
+                  << std::fixed << std::setprecision(2)
+                  << result.queries / result.seconds_batch / 1e6 << " M affectations/s en lot ("
+                  << result.queries / result.seconds_batch / result.threads / 1e6 << " M/s par cœur), "
+                  << result.queries / result.seconds_scalar / 1e6 << " M/s unitaire, "
+                  << result.mismatches_training << " points de l'instance réaffectés différemment" << std::endl;
+    }
+};
+
+struct CoresetResult {
+    std::string instance_name;
+    std::string criterion;
+    size_t N;
+    size_t K;
+    size_t L;
+    double cost_exact;       // DP exacte bornée à L
+    double cost_approx;      // Solution approchée, coût sur tous les points
+    double lower_bound;      // Borne inférieure certifiée du solveur approché
+    size_t coreset_size;
+    double seconds_exact;
+    double seconds_approx;
+};
+
+// Compare le solveur approché (coreset) à la DP exacte bornée
+class CoresetBenchmark : public ResultTableBenchmark<CoresetResult> {
+private:
+    std::vector<std::string> instance_files;
+    double epsilon;
+
+    template <typename SolverType>
+    void compare(const std::string& instance_file, const std::string& criterion, bool squared) {
+        CoresetResult result;
+        result.instance_name = instanceName(instance_file);
+        result.criterion = criterion;
+
+        SolverType exact;
+        exact.import(instance_file);
+        exact.setNbClusters();
+        result.N = exact.getNbPoints();
+        result.K = exact.getNbClusters();
+        result.L = boundedLength(result.N, result.K, 0);
+        configureBounded(exact, result.L);
+
+        auto start = std::chrono::steady_clock::now();
+        exact.solve();
+        result.seconds_exact = secondsSince(start);
+        result.cost_exact = exact.getSolutionCost();
+
+        CoresetDP approx(squared);
+        approx.import(instance_file);
+        approx.setNbClusters();
+        approx.setEpsilon(epsilon);
+
+        start = std::chrono::steady_clock::now();
+        approx.solve();
+        result.seconds_approx = secondsSince(start);
+        result.cost_approx = approx.getSolutionCost();
+        result.lower_bound = approx.getLowerBound();
+        result.coreset_size = approx.getReport().coresetSize;
+
+        results.push_back(result);
+    }
+
+public:
+    CoresetBenchmark(const std::vector<std::string>& instances, double eps)
+            : instance_files(instances), epsilon(eps) {}
+
+    void run() override {
+        forEachInstance(instance_files, [&](const std::string& instance_file) {
+            compare<MedoidsDP>(instance_file, "medoids", true);
+            compare<MedianDP>(instance_file, "median", false);
+        });
+    }
+
+    std::string csvHeader() const override {
+        return "instance,criterion,N,K,L,coreset_size,cost_exact,cost_approx,lower_bound,"
+               "ratio_to_exact,ratio_to_bound,seconds_exact,seconds_approx";
+    }
+
+    void writeResult(std::ostream& file, const CoresetResult& result) const override {
+        file << result.instance_name << ","
+             << result.criterion << ","
+             << result.N << ","
+             << result.K << ","
+             << result.L << ","
+             << result.coreset_size << ","
+             << std::scientific << std::setprecision(12)
+             << result.cost_exact << ","
+             << result.cost_approx << ","
+             << result.lower_bound << ","
+             << std::fixed << std::setprecision(6)
+             << result.cost_approx / result.cost_exact << ","
+             << result.cost_approx / result.lower_bound << ","
+             << result.seconds_exact << ","
+             << result.seconds_approx << std::endl;
+    }
+
+    std::string summaryTitle() const override { return "SOLVEUR APPROCHÉ (CORESET)"; }
+
+    void printResult(const CoresetResult& result) const override {
+        std::cout << result.instance_name << " [" << result.criterion << "] (N=" << result.N
+                  << ", K=" << result.K << ", coreset " << result.coreset_size << "): "
+                  << std::fixed << std::setprecision(4)
+                  << "coût / exact = " << result.cost_approx / result.cost_exact
+                  << ", coût / borne = " << result.cost_approx / result.lower_bound << ", "
+                  << result.seconds_exact << " s -> " << result.seconds_approx << " s" << std::endl;
+    }
+};
+
+// Coût optimal d'une partition des points (triés) en K intervalles de minLength à maxLength points, par une DP
+// scalaire de référence. Le coût d'un intervalle est le minimum, sur ses points, de la somme des distances des autres :
+// ces sommes sont étendues point par point (O(L) par extension, O(N L²) en tout), indépendamment des solveurs
+double referenceIntervalCost(const std::vector<double>& points, size_t N, size_t D, size_t K,
+                             size_t maxLength, size_t minLength, bool squared) {
+    const double infinity = std::numeric_limits<double>::infinity();
+    auto distance = [&](size_t i, size_t j) {
+        double dist_sq = 0.0;
+        for (size_t d = 0; d < D; d++) {
+            double diff = points[i * D + d] - points[j * D + d];
+            dist_sq += diff * diff;
+        }
+        return squared ? dist_sq : std::sqrt(dist_sq);
+    };
+
+    std::vector<std::vector<double>> interval(N, std::vector<double>(N, infinity));
+    std::vector<double> sums;
+    for (size_t start = 0; start < N; start++) {
+        sums.clear();
+        for (size_t end = start; end < N && end - start < maxLength; end++) {
+            // sums[c] : somme des distances de start..end au point start + c
+            double added = 0.0;
+            for (size_t c = 0; c < sums.size(); c++) {
+                double dist = distance(end, start + c);
+                sums[c] += dist;
+                added += dist;
+            }
+            sums.push_back(added);
+            interval[start][end] = *std::min_element(sums.begin(), sums.end());
+        }
+    }
+
+    // best[k][n] : k + 1 intervalles couvrant les points 0..n
+    std::vector<std::vector<double>> best(K, std::vector<double>(N, infinity));
+    for (size_t n = 0; n < N; n++) {
+        if (n + 1 >= minLength) best[0][n] = interval[0][n];
+    }
+    for (size_t k = 1; k < K; k++) {
+        for (size_t n = 0; n < N; n++) {
+            for (size_t split = 0; split < n; split++) {
+                if (n - split < minLength || best[k - 1][split] == infinity) continue;
+                best[k][n] = std::min(best[k][n], best[k - 1][split] + interval[split + 1][n]);
+            }
+        }
+    }
+    return best[K - 1][N - 1];
+}
+
+struct PamResult {
+    std::string instance_name;
+    std::string criterion;
+    size_t N;
+    size_t K;
+    size_t L;
+    double cost_dp;          // DP par intervalles bornée à L
+    double cost_exact;       // Optimum des partitions en intervalles sans borne (DP de référence)
+    double cost_kmpp;        // FasterPAM, initialisation k-means++
+    double cost_build;       // FasterPAM, initialisation BUILD
+    size_t swaps_kmpp;
+    size_t swaps_build;
+    double seconds_dp;
+    double seconds_exact;    // DP de référence, en O(N³)
+    double seconds_kmpp;
+    double seconds_build;
+};
+
+// Compare FasterPAM (sans ordre des points) à la DP par intervalles sur les fronts 2D
+class PamBenchmark : public ResultTableBenchmark<PamResult> {
+private:
+    std::vector<std::string> instance_files;
+    size_t length_bound; // 0 : 4 * N / K
+
+    double solvePam(const std::string& instance_file, bool squared, PamSeeding seeding, size_t& swaps) {
+        FasterPAM pam(squared);
+        pam.import(instance_file);
+        pam.setNbClusters();
+        pam.setDistanceMatrixBudget(DISTANCE_MATRIX_BUDGET);
+        pam.setSeeding(seeding);
+        pam.solve();
+        swaps = pam.getStats().swaps;
+        return pam.getSolutionCost();
+    }
+
+    template <typename SolverType>
+    void compare(const std::string& instance_file, const std::string& criterion, bool squared) {
+        PamResult result;
+        result.instance_name = instanceName(instance_file);
+        result.criterion = criterion;
+
+        SolverType dp;
+        dp.import(instance_file);
+        dp.setNbClusters();
+        result.N = dp.getNbPoints();
+        result.K = dp.getNbClusters();
+        result.L = boundedLength(result.N, result.K, length_bound);
+        configureBounded(dp, result.L);
+
+        auto start = std::chrono::steady_clock::now();
+        dp.solve();
+        result.seconds_dp = secondsSince(start);
+        result.cost_dp = dp.getSolutionCost();
+
+        // Optimum sans borne des partitions en intervalles (coût de la DP sans borne) par la DP de référence :
+        // la DP des solveurs sans borne recalcule les coûts de tous les clusters à chaque case et ne termine pas
+        // en un temps raisonnable à N = 1000
+        start = std::chrono::steady_clock::now();
+        result.cost_exact = referenceIntervalCost(dp.getPoints(), result.N, dp.getDimension(), result.K,
+                                                  result.N, 1, squared);
+        result.seconds_exact = secondsSince(start);
+
+        start = std::chrono::steady_clock::now();
+        result.cost_kmpp = solvePam(instance_file, squared, PamSeeding::KMEANS_PLUS_PLUS, result.swaps_kmpp);
+        result.seconds_kmpp = secondsSince(start);
+
+        start = std::chrono::steady_clock::now();
+        result.cost_build = solvePam(instance_file, squared, PamSeeding::BUILD, result.swaps_build);
+        result.seconds_build = secondsSince(start);
+
+        results.push_back(result);
+    }
+
+public:
+    PamBenchmark(const std::vector<std::string>& instances, size_t L)
+            : instance_files(instances), length_bound(L) {}
+
+    void run() override {
+        forEachInstance(instance_files, [&](const std::string& instance_file) {
+            compare<MedoidsDP>(instance_file, "medoids", true);
+            compare<MedianDP>(instance_file, "median", false);
+        });
+    }
+
+    std::string csvHeader() const override {
+        return "instance,criterion,N,K,L,cost_dp,cost_exact,cost_pam_kmpp,cost_pam_build,ratio_kmpp,ratio_build,"
+               "ratio_kmpp_exact,ratio_build_exact,swaps_kmpp,swaps_build,seconds_dp,seconds_exact,seconds_kmpp,"
+               "seconds_build";
+    }
+
+    void writeResult(std::ostream& file, const PamResult& result) const override {
+        file << result.instance_name << ","
+             << result.criterion << ","
+             << result.N << ","
+             << result.K << ","
+             << result.L << ","
+             << std::scientific << std::setprecision(12)
+             << result.cost_dp << ","
+             << result.cost_exact << ","
+             << result.cost_kmpp << ","
+             << result.cost_build << ","
+             << std::fixed << std::setprecision(6)
+             << result.cost_kmpp / result.cost_dp << ","
+             << result.cost_build / result.cost_dp << ","
+             << result.cost_kmpp / result.cost_exact << ","
+             << result.cost_build / result.cost_exact << ","
+             << result.swaps_kmpp << ","
+             << result.swaps_build << ","
+             << result.seconds_dp << ","
+             << result.seconds_exact << ","
+             << result.seconds_kmpp << ","
+             << result.seconds_build << std::endl;
+    }
+
+    std::string summaryTitle() const override { return "FASTERPAM CONTRE DP PAR INTERVALLES"; }
+
+    void printResult(const PamResult& result) const override {
+        std::cout << result.instance_name << " [" << result.criterion << "] (N=" << result.N
+                  << ", K=" << result.K << ", L=" << result.L << "): "
+                  << std::fixed << std::setprecision(4)
+                  << "coût / DP = " << result.cost_kmpp / result.cost_dp << " (k-means++), "
+                  << result.cost_build / result.cost_dp << " (BUILD), coût / DP sans borne = "
+                  << result.cost_kmpp / result.cost_exact << " (k-means++), "
+                  << result.cost_build / result.cost_exact << " (BUILD), "
+                  << result.seconds_dp << " s, " << result.seconds_exact << " s sans borne -> "
+                  << result.seconds_kmpp << " s, "
+                  << result.seconds_build << " s" << std::endl;
+    }
+};
+
+struct KMeansResult {
+    std::string instance_name;
+    size_t N;
+    size_t K;
+    size_t L;
+    double cost_medoids;     // MedoidsDP bornée à L
+    double cost_kmeans;      // K-means par intervalles (minore le coût k-medoids)
+    double cost_warm;        // MedoidsDP démarrée à chaud sur les intervalles k-means
+    size_t exact_costs_warm; // Coûts d'intervalle exacts évalués en démarrage à chaud
+    size_t full_costs;       // Coûts évalués par un remplissage complet
+    double seconds_medoids;
+    double seconds_kmeans;
+    double seconds_warm;
+};
+
+// K-means par intervalles : temps, borne inférieure du k-medoids et démarrage à chaud de MedoidsDP
+class KMeansBenchmark : public ResultTableBenchmark<KMeansResult> {
+private:
+    std::vector<std::string> instance_files;
+    size_t length_bound; // 0 : 4 * N / K
+    size_t warm_window;
+
+    double solveMedoids(const std::string& instance_file, size_t L, const KMeansDP* warm, KMeansResult& result) {
+        MedoidsDP solver;
+        solver.import(instance_file);
+        solver.setNbClusters();
+        configureBounded(solver, L, warm == nullptr);
+        if (warm) solver.setWarmStart(warm->getSolutionIntervals(), warm->getNbPoints(), static_cast<uint>(warm_window));
+
+        auto start = std::chrono::steady_clock::now();
+        solver.solve();
+        double seconds = secondsSince(start);
+
+        if (warm) {
+            WarmStartStats stats = solver.getWarmStartStats();
+            result.exact_costs_warm = stats.windowCosts + stats.widenedCosts;
+            result.full_costs = stats.fullCosts;
+            result.cost_warm = solver.getSolutionCost();
+        } else {
+            result.cost_medoids = solver.getSolutionCost();
+        }
+        return seconds;
+    }
+
+public:
+    KMeansBenchmark(const std::vector<std::string>& instances, size_t L, size_t window)
+            : instance_files(instances), length_bound(L), warm_window(window) {}
+
+    void run() override {
+        forEachInstance(instance_files, [&](const std::string& instance_file) {
+            KMeansDP kmeans;
+            kmeans.import(instance_file);
+            kmeans.setNbClusters();
+
+            KMeansResult result;
+            result.instance_name = instanceName(instance_file);
+            result.N = kmeans.getNbPoints();
+            result.K = kmeans.getNbClusters();
+            result.L = boundedLength(result.N, result.K, length_bound);
+
+            auto start = std::chrono::steady_clock::now();
+            kmeans.solve();
+            result.seconds_kmeans = secondsSince(start);
+            result.cost_kmeans = kmeans.getSolutionCost();
+
+            result.seconds_medoids = solveMedoids(instance_file, result.L, nullptr, result);
+            result.seconds_warm = solveMedoids(instance_file, result.L, &kmeans, result);
+
+            results.push_back(result);
+        });
+    }
+
+    std::string csvHeader() const override {
+        return "instance,N,K,L,cost_medoids,cost_kmeans,bound_ratio,cost_warm,same_cost,"
+               "exact_costs_warm,full_costs,seconds_medoids,seconds_kmeans,seconds_warm";
+    }
+
+    void writeResult(std::ostream& file, const KMeansResult& result) const override {
+        file << result.instance_name << ","
+             << result.N << ","
+             << result.K << ","
+             << result.L << ","
+             << std::scientific << std::setprecision(12)
+             << result.cost_medoids << ","
+             << result.cost_kmeans << ","
+             << std::fixed << std::setprecision(6)
+             << result.cost_kmeans / result.cost_medoids << ","
+             << std::scientific << std::setprecision(12)
+             << result.cost_warm << ","
+             << (result.cost_warm == result.cost_medoids ? 1 : 0) << ","
+             << result.exact_costs_warm << ","
+             << result.full_costs << ","
+             << std::fixed << std::setprecision(6)
+             << result.seconds_medoids << ","
+             << result.seconds_kmeans << ","
+             << result.seconds_warm << std::endl;
+    }
+
+    std::string summaryTitle() const override { return "K-MEANS PAR INTERVALLES"; }
+
+    void printResult(const KMeansResult& result) const override {
+        std::cout << result.instance_name << " (N=" << result.N << ", K=" << result.K << ", L=" << result.L << "): "
+                  << std::fixed << std::setprecision(4)
+                  << "k-means / k-medoids = " << result.cost_kmeans / result.cost_medoids << ", "
+                  << result.seconds_kmeans << " s contre " << result.seconds_medoids << " s ; "
+                  << "démarrage à chaud " << result.seconds_warm << " s, "
+                  << result.exact_costs_warm << " / " << result.full_costs << " coûts exacts"
+                  << (result.cost_warm == result.cost_medoids ? "" : " ✗ coûts différents") << std::endl;
+    }
+};
+
+struct KCenterResult {
+    std::string instance_name;
+    size_t N;
+    size_t K;
+    size_t L;
+    double radius_kcenter;   // Plus grand rayon de la solution k-center
+    double radius_medoids;   // Plus grand rayon de la solution MedoidsDP (distance au médoïde)
+    size_t feasibility_checks;
+    double seconds_kcenter;
+    double seconds_medoids;
+};
+
+// K-center par intervalles contre le rayon obtenu par la DP k-medoids bornée
+class KCenterBenchmark : public ResultTableBenchmark<KCenterResult> {
+private:
+    std::vector<std::string> instance_files;
+    size_t length_bound; // 0 : 4 * N / K
+
+public:
+    KCenterBenchmark(const std::vector<std::string>& instances, size_t L)
+            : instance_files(instances), length_bound(L) {}
+
+    void run() override {
+        forEachInstance(instance_files, [&](const std::string& instance_file) {
+            KCenter kcenter;
+            kcenter.import(instance_file);
+            kcenter.setNbClusters();
+
+            KCenterResult result;
+            result.instance_name = instanceName(instance_file);
+            result.N = kcenter.getNbPoints();
+            result.K = kcenter.getNbClusters();
+            result.L = boundedLength(result.N, result.K, length_bound);
+
+            auto start = std::chrono::steady_clock::now();
+            kcenter.solve();
+            result.seconds_kcenter = secondsSince(start);
+            result.radius_kcenter = kcenter.getSolutionCost();
+            result.feasibility_checks = kcenter.getFeasibilityChecks();
+            kcenter.saveToCSV("results/kcenter_" + result.instance_name + ".csv");
+
+            MedoidsDP medoids;
+            medoids.import(instance_file);
+            medoids.setNbClusters();
+            configureBounded(medoids, result.L);
+
+            start = std::chrono::steady_clock::now();
+            medoids.solve();
+            result.seconds_medoids = secondsSince(start);
+
+            // Rayon de la solution k-medoids : distance maximale d'un point à son médoïde
+            const std::vector<double>& points = medoids.getPoints();
+            const auto& intervals = medoids.getSolutionIntervals();
+            const auto& centers = medoids.getIntervalCenters();
+            size_t D = medoids.getDimension();
+            result.radius_medoids = 0.0;
+            for (size_t c = 0; c < intervals.size(); c++) {
+                for (size_t i = intervals[c].first; i <= intervals[c].second; i++) {
+                    double squared = 0.0;
+                    for (size_t d = 0; d < D; d++) {
+                        double diff = points[i * D + d] - points[centers[c] * D + d];
+                        squared += diff * diff;
+                    }
+                    result.radius_medoids = std::max(result.radius_medoids, std::sqrt(squared));
+                }
+            }
+
+            results.push_back(result);
+        });
+    }
+
+    std::string csvHeader() const override {
+        return "instance,N,K,L,radius_kcenter,radius_medoids,radius_ratio,feasibility_checks,"
+               "seconds_kcenter,seconds_medoids";
+    }
+
+    void writeResult(std::ostream& file, const KCenterResult& result) const override {
+        file << result.instance_name << ","
+             << result.N << ","
+             << result.K << ","
+             << result.L << ","
+             << std::scientific << std::setprecision(12)
+             << result.radius_kcenter << ","
+             << result.radius_medoids << ","
+             << std::fixed << std::setprecision(6)
+             << result.radius_kcenter / result.radius_medoids << ","
+             << result.feasibility_checks << ","
+             << result.seconds_kcenter << ","
+             << result.seconds_medoids << std::endl;
+    }
+
+    std::string summaryTitle() const override { return "K-CENTER PAR INTERVALLES"; }
+
+    void printResult(const KCenterResult& result) const override {
+        std::cout << result.instance_name << " (N=" << result.N << ", K=" << result.K << "): "
+                  << std::fixed << std::setprecision(4)
+                  << "rayon " << result.radius_kcenter << " contre " << result.radius_medoids << " (k-medoids), "
+                  << result.feasibility_checks << " tests, "
+                  << result.seconds_kcenter << " s contre " << result.seconds_medoids << " s" << std::endl;
+    }
+};
+
+struct ApiLatencyResult {
+    std::string instance_name;
+    size_t N;
+    size_t K;
+    size_t repetitions;
+    double seconds_file;     // Écriture du fichier texte, import et solve
+    double seconds_api;      // clustering::solve sur le tampon en mémoire
+    bool same_cost;
+};
+
+// Latence d'un solve k-medoids via un fichier texte intermédiaire contre l'API en mémoire
+class ApiLatencyBenchmark : public ResultTableBenchmark<ApiLatencyResult> {
+private:
+    std::vector<std::string> instance_files;
+    size_t repetitions;
+
+public:
+    ApiLatencyBenchmark(const std::vector<std::string>& instances, size_t reps)
+            : instance_files(instances), repetitions(reps) {}
+
+    void run() override {
+        const std::string scratch = "results/api_roundtrip.txt";
+        forEachInstance(instance_files, [&](const std::string& instance_file) {
+            MedoidsDP probe;
+            probe.import(instance_file);
+            probe.setNbClusters();
+            std::vector<double> points = probe.getPoints();
+
+            ApiLatencyResult result;
+            result.instance_name = instanceName(instance_file);
+            result.N = probe.getNbPoints();
+            result.K = probe.getNbClusters();
+            result.repetitions = repetitions;
+            size_t D = probe.getDimension();
+
+            double cost_file = 0.0;
+            auto start = std::chrono::steady_clock::now();
+            for (size_t r = 0; r < repetitions; r++) {
+                {
+                    std::ofstream file(scratch);
+                    file << result.N << " " << D << "\n" << std::setprecision(17);
+                    for (size_t i = 0; i < result.N; i++) {
+                        for (size_t d = 0; d < D; d++) file << points[i * D + d] << (d + 1 < D ? " " : "\n");
+                    }
+                }
+                MedoidsDP solver;
+                solver.import(scratch);
+                solver.setNbClusters(result.K);
+                solver.solve();
+                cost_file = solver.getSolutionCost();
+            }
+            result.seconds_file = secondsSince(start)
+                                  / static_cast<double>(repetitions);
+
+            clustering::Options options;
+            options.quiet = true; // Traces des solveurs coupées pendant la mesure
+            std::vector<size_t> labels(result.N);
+            double cost_api = 0.0;
+            clustering::ResultBuffers buffers;
+            buffers.labels = labels.data();
+            buffers.cost = &cost_api;
+            start = std::chrono::steady_clock::now();
+            for (size_t r = 0; r < repetitions; r++) {
+                clustering::solve({points.data(), result.N, D, D}, result.K, clustering::Criterion::MEDOIDS,
+                                  options, buffers);
+            }
+            result.seconds_api = secondsSince(start)
+                                 / static_cast<double>(repetitions);
+            result.same_cost = (cost_file == cost_api);
+
+            results.push_back(result);
+        });
+        std::remove(scratch.c_str());
+    }
+
+    std::string csvHeader() const override {
+        return "instance,N,K,repetitions,seconds_file,seconds_api,speedup,same_cost";
+    }
+
+    void writeResult(std::ostream& file, const ApiLatencyResult& result) const override {
+        file << result.instance_name << ","
+             << result.N << ","
+             << result.K << ","
+             << result.repetitions << ","
+             << std::fixed << std::setprecision(6)
+             << result.seconds_file << ","
+             << result.seconds_api << ","
+             << result.seconds_file / result.seconds_api << ","
+             << (result.same_cost ? 1 : 0) << std::endl;
+    }
+
+    std::string summaryTitle() const override { return "LATENCE : FICHIER CONTRE API EN MÉMOIRE"; }
+
+    void printResult(const ApiLatencyResult& result) const override {
+        std::cout << result.instance_name << " (N=" << result.N << ", K=" << result.K << "): "
+                  << std::fixed << std::setprecision(6)
+                  << result.seconds_file << " s -> " << result.seconds_api << " s par solve"
+                  << (result.same_cost ? "" : " ✗ coûts différents") << std::endl;
+    }
+};
+
+// Solves k-medoids et p-median de toutes les instances : clustering::solve l'un après l'autre,
+// puis clustering::solveAsync tous soumis d'un coup au pool de la bibliothèque
+class AsyncBenchmark : public Benchmark {
+private:
+    std::vector<std::string> instance_files;
+    size_t jobs;
+    double seconds_sequential;
+    double seconds_async;
+    bool same_costs;
+
+public:
+    explicit AsyncBenchmark(const std::vector<std::string>& instances)
+            : instance_files(instances), jobs(0), seconds_sequential(0.0), seconds_async(0.0), same_costs(true) {}
+
+    void run() override {
+        struct Job {
+            std::vector<double> points;
+            size_t N, D, K;
+            clustering::Criterion criterion;
+            double cost_sequential;
+            double cost_async;
+        };
+        std::vector<Job> work;
+        forEachInstance(instance_files, [&](const std::string& instance_file) {
+            MedoidsDP probe;
+            probe.import(instance_file);
+            probe.setNbClusters();
+            for (clustering::Criterion criterion : {clustering::Criterion::MEDOIDS, clustering::Criterion::MEDIAN}) {
+                work.push_back(Job{probe.getPoints(), probe.getNbPoints(), probe.getDimension(),
+                                   probe.getNbClusters(), criterion, 0.0, 0.0});
+            }
+        });
+        jobs = work.size();
+
+        clustering::Options options;
+        options.quiet = true; // Traces des solves concurrents coupées (elles seraient entremêlées)
+        auto start = std::chrono::steady_clock::now();
+        for (Job& job : work) {
+            clustering::ResultBuffers buffers;
+            buffers.cost = &job.cost_sequential;
+            clustering::solve({job.points.data(), job.N, job.D, job.D}, job.K, job.criterion, options, buffers);
+        }
+        seconds_sequential = secondsSince(start);
+
+        start = std::chrono::steady_clock::now();
+        std::vector<std::future<clustering::SolveStatus>> pending;
+        for (Job& job : work) {
+            clustering::ResultBuffers buffers;
+            buffers.cost = &job.cost_async;
+            pending.push_back(clustering::solveAsync({job.points.data(), job.N, job.D, job.D}, job.K, job.criterion,
+                                                     options, buffers));
+        }
+        for (auto& status : pending) {
+            clustering::SolveStatus outcome = status.get();
+            if (outcome.code != CLUSTERING_OK) std::cerr << "  ✗ Error: " << outcome.error << std::endl;
+        }
+        seconds_async = secondsSince(start);
+
+        for (const Job& job : work) same_costs = same_costs && job.cost_sequential == job.cost_async;
+    }
+
+    void writeResults(std::ostream& file) override {
+        file << "workers,thread_budget,jobs,seconds_sequential,seconds_async,speedup,same_costs" << std::endl;
+        file << SolverPool::shared().getWorkers() << ","
+             << SolverPool::shared().getThreadBudget() << ","
+             << jobs << ","
+             << std::fixed << std::setprecision(6)
+             << seconds_sequential << ","
+             << seconds_async << ","
+             << seconds_sequential / seconds_async << ","
+             << (same_costs ? 1 : 0) << std::endl;
+    }
+
+    void printSummary() override {
+        std::cout << "\n=== SOLVES ASYNCHRONES ===" << std::endl;
+        std::cout << jobs << " solves, " << SolverPool::shared().getWorkers() << " travaux simultanés, "
+                  << SolverPool::shared().getThreadBudget() << " threads OpenMP partagés: "
+                  << std::fixed << std::setprecision(4)
+                  << seconds_sequential << " s -> " << seconds_async << " s"
+                  << (same_costs ? "" : " ✗ coûts différents") << std::endl;
+    }
+};
+
+struct ScalingResult {
+    size_t N;
+    size_t K;
+    double seconds_generate;
+    double seconds_kmeans;
+    double cost_kmeans;
+    double seconds_kcenter;
+    double cost_kcenter;
+    double seconds_coreset;
+    double cost_coreset;     // K-medoids approché (coreset)
+    size_t L;                // Borne de la DP exacte (4 N / K)
+    double seconds_medoids;  // DP exacte bornée, -1 au-delà de exact_limit
+    double cost_medoids;
+};
+
+// Passage à l'échelle sur des fronts synthétiques : N de 100 à max_points (facteur 10)
+class ScalingBenchmark : public ResultTableBenchmark<ScalingResult> {
+private:
+    FrontOptions front;
+    size_t max_points;
+    size_t exact_limit;  // N maximal de la DP exacte k-medoids
+
+    template <typename SolverType>
+    static double timeSolve(SolverType& solver, const std::vector<double>& points, const FrontOptions& options,
+                            size_t K, double& cost) {
+        solver.setPoints(points.data(), options.N, options.D, options.D);
+        solver.setNbClusters(K);
+
+        QuietOutput quiet;
+        auto start = std::chrono::steady_clock::now();
+        solver.solve();
+        double seconds = secondsSince(start);
+        cost = solver.getSolutionCost();
+        return seconds;
+    }
+
+public:
+    ScalingBenchmark(const FrontOptions& options, size_t maxPoints, size_t exactLimit)
+            : front(options), max_points(maxPoints), exact_limit(exactLimit) {}
+
+    void run() override {
+        std::vector<size_t> sizes;
+        for (size_t N = 100; N < max_points; N *= 10) sizes.push_back(N);
+        sizes.push_back(max_points);
+
+        for (size_t N : sizes) {
+            try {
+                FrontOptions options = front;
+                options.N = N;
+                ScalingResult result;
+                result.N = N;
+                result.K = std::min<size_t>(16, N);
+                result.L = boundedLength(N, result.K, 0);
+                std::cout << "Front " << FrontGenerator::shapeName(options.shape) << " N=" << N << std::endl;
+
+                auto start = std::chrono::steady_clock::now();
+                std::vector<double> points = FrontGenerator(options).generate();
+                result.seconds_generate = secondsSince(start);
+
+                KMeansDP kmeans;
+                result.seconds_kmeans = timeSolve(kmeans, points, options, result.K, result.cost_kmeans);
+                KCenter kcenter;
+                result.seconds_kcenter = timeSolve(kcenter, points, options, result.K, result.cost_kcenter);
+                CoresetDP coreset;
+                result.seconds_coreset = timeSolve(coreset, points, options, result.K, result.cost_coreset);
+
+                result.seconds_medoids = -1.0;
+                result.cost_medoids = -1.0;
+                if (N <= exact_limit) {
+                    MedoidsDP medoids;
+                    configureBounded(medoids, result.L);
+                    result.seconds_medoids = timeSolve(medoids, points, options, result.K, result.cost_medoids);
+                }
+
+                results.push_back(result);
+            } catch (const std::exception& e) {
+                std::cerr << "  ✗ Error: " << e.what() << std::endl;
+            }
+        }
+    }
+
+    std::string csvHeader() const override {
+        return "shape,D,seed,N,K,L,seconds_generate,seconds_kmeans,seconds_kcenter,seconds_coreset,seconds_medoids,"
+               "cost_kmeans,cost_kcenter,cost_coreset,cost_medoids";
+    }
+
+    void writeResult(std::ostream& file, const ScalingResult& result) const override {
+        file << FrontGenerator::shapeName(front.shape) << ","
+             << front.D << ","
+             << front.seed << ","
+             << result.N << ","
+             << result.K << ","
+             << result.L << ","
+             << std::fixed << std::setprecision(6)
+             << result.seconds_generate << ","
+             << result.seconds_kmeans << ","
+             << result.seconds_kcenter << ","
+             << result.seconds_coreset << ","
+             << result.seconds_medoids << ","
+             << std::scientific << std::setprecision(12)
+             << result.cost_kmeans << ","
+             << result.cost_kcenter << ","
+             << result.cost_coreset << ","
+             << result.cost_medoids << std::endl;
+    }
+
+    std::string summaryTitle() const override {
+        return "PASSAGE À L'ÉCHELLE (" + FrontGenerator::shapeName(front.shape) + ", D=" + std::to_string(front.D) + ")";
+    }
+
+    void printResult(const ScalingResult& result) const override {
+        std::cout << "N=" << result.N << ", K=" << result.K << ": " << std::fixed << std::setprecision(4)
+                  << "génération " << result.seconds_generate << " s, k-means " << result.seconds_kmeans
+                  << " s, k-center " << result.seconds_kcenter << " s, coreset " << result.seconds_coreset << " s";
+        if (result.seconds_medoids >= 0.0) std::cout << ", DP exacte " << result.seconds_medoids << " s";
+        std::cout << std::endl;
+    }
+};
+
+double evaluatePartition(const std::vector<double>& points, const std::vector<size_t>& solution,
+                         size_t N, size_t D, size_t K, bool squared);
+
+struct DeadlineResult {
+    std::string instance_name;
+    size_t N;
+    size_t K;
+    double budget_fraction;     // Budget en fraction du solve complet (0 : annulation)
+    double budget_seconds;
+    double seconds;             // Durée de solveWithin
+    unsigned rows_completed;
+    unsigned fallback_clusters;
+    bool optimal;
+    double cost_ratio;          // Coût rendu / coût optimal
+};
+
+// Solve borné : qualité de la solution de repli et respect de l'échéance pour des budgets
+// en fraction du solve complet, puis latence d'une annulation en cours de remplissage
+class DeadlineBenchmark : public ResultTableBenchmark<DeadlineResult> {
+private:
+    std::vector<std::string> instance_files;
+    size_t length_bound; // 0 : 4 * N / K
+
+public:
+    DeadlineBenchmark(const std::vector<std::string>& instances, size_t L)
+            : instance_files(instances), length_bound(L) {}
+
+    void run() override {
+        forEachInstance(instance_files, [&](const std::string& instance_file) {
+            MedoidsDP reference;
+            configure(reference, instance_file);
+            auto start = std::chrono::steady_clock::now();
+            reference.solve();
+            double full_seconds = secondsSince(start);
+            double optimal_cost = reference.getSolutionCost();
+
+            for (double fraction : {0.25, 0.5, 0.75, 1.5}) {
+                MedoidsDP solver;
+                configure(solver, instance_file);
+                auto budget = std::chrono::duration<double>(fraction * full_seconds);
+                SolveOutcome outcome = solver.solveWithin(
+                        std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(budget));
+                results.push_back(makeResult(instance_file, solver, fraction, budget.count(), outcome, optimal_cost));
+            }
+
+            // Annulation à mi-parcours depuis un autre thread : seconds mesure le délai jusqu'au retour
+            MedoidsDP solver;
+            configure(solver, instance_file);
+            CancellationToken token;
+            std::chrono::steady_clock::time_point cancelled_at;
+            std::thread canceller([&]() {
+                std::this_thread::sleep_for(std::chrono::duration<double>(0.5 * full_seconds));
+                cancelled_at = std::chrono::steady_clock::now();
+                token.cancel();
+            });
+            SolveOutcome outcome = solver.solveWithin(std::chrono::steady_clock::time_point::max(), &token);
+            auto returned_at = std::chrono::steady_clock::now();
+            canceller.join();
+            outcome.seconds = outcome.cancelled ? std::chrono::duration<double>(returned_at - cancelled_at).count() : 0.0;
+            results.push_back(makeResult(instance_file, solver, 0.0, 0.5 * full_seconds, outcome, optimal_cost));
+        });
+    }
+
+    std::string csvHeader() const override {
+        return "instance,N,K,budget_fraction,budget_seconds,seconds,rows_completed,fallback_clusters,"
+               "optimal,cost_ratio";
+    }
+
+    void writeResult(std::ostream& file, const DeadlineResult& result) const override {
+        file << result.instance_name << ","
+             << result.N << ","
+             << result.K << ","
+             << std::fixed << std::setprecision(6)
+             << result.budget_fraction << ","
+             << result.budget_seconds << ","
+             << result.seconds << ","
+             << result.rows_completed << ","
+             << result.fallback_clusters << ","
+             << (result.optimal ? 1 : 0) << ","
+             << result.cost_ratio << std::endl;
+    }
+
+    std::string summaryTitle() const override { return "SOLVE BORNÉ DANS LE TEMPS"; }
+
+    void printResult(const DeadlineResult& result) const override {
+        std::cout << result.instance_name << " (N=" << result.N << ", K=" << result.K << ") "
+                  << std::fixed << std::setprecision(4);
+        if (result.budget_fraction > 0.0) {
+            std::cout << "budget " << result.budget_seconds << " s: " << result.seconds << " s, ";
+        } else {
+            std::cout << "annulation: retour en " << result.seconds << " s, ";
+        }
+        std::cout << result.rows_completed << "/" << result.K << " lignes, coût x" << result.cost_ratio
+                  << (result.optimal ? " (optimal)" : " (repli)") << std::endl;
+    }
+
+private:
+    void configure(MedoidsDP& solver, const std::string& instance_file) const {
+        solver.import(instance_file);
+        solver.setNbClusters();
+        size_t N = solver.getNbPoints(), K = solver.getNbClusters();
+        size_t L = boundedLength(N, K, length_bound);
+        configureBounded(solver, L);
+    }
+
+    DeadlineResult makeResult(const std::string& instance_file, const MedoidsDP& solver, double fraction,
+                              double budget_seconds, const SolveOutcome& outcome, double optimal_cost) const {
+        DeadlineResult result;
+        result.instance_name = instanceName(instance_file);
+        result.N = solver.getNbPoints();
+        result.K = solver.getNbClusters();
+        result.budget_fraction = fraction;
+        result.budget_seconds = budget_seconds;
+        result.seconds = outcome.seconds;
+        result.rows_completed = outcome.rowsCompleted;
+        result.fallback_clusters = outcome.fallbackClusters;
+        result.optimal = outcome.optimal;
+        // Repli au coût estimé (sans bande de coûts complète) : partition réévaluée, hors du temps mesuré
+        double cost = outcome.exactCost ? solver.getSolutionCost()
+                                        : evaluatePartition(solver.getPoints(), solver.getSolution(), result.N,
+                                                            solver.getDimension(), result.K, true);
+        result.cost_ratio = optimal_cost > 0.0 ? cost / optimal_cost : 1.0;
+        return result;
+    }
+};
+
+// Coût d'une partition (étiquettes 1..K) recalculé par force brute, centre optimal de chaque cluster
+// parmi ses points : distances carrées (k-medoids) ou distances (p-median), sans passer par un solveur
+double evaluatePartition(const std::vector<double>& points, const std::vector<size_t>& solution,
+                         size_t N, size_t D, size_t K, bool squared) {
+    double total_cost = 0.0;
+    for (size_t k = 1; k <= K; k++) {
+        std::vector<size_t> cluster_points;
+        for (size_t i = 0; i < N; i++) {
+            if (solution[i] == k) cluster_points.push_back(i);
+        }
+
+        double min_cost = cluster_points.empty() ? 0.0 : std::numeric_limits<double>::max();
+        for (size_t center : cluster_points) {
+            double cost = 0.0;
+            for (size_t point : cluster_points) {
+                double dist_sq = 0.0;
+                for (size_t d = 0; d < D; d++) {
+                    double diff = points[point * D + d] - points[center * D + d];
+                    dist_sq += diff * diff;
+                }
+                cost += squared ? dist_sq : std::sqrt(dist_sq);
+            }
+            min_cost = std::min(min_cost, cost);
+        }
+        total_cost += min_cost;
+    }
+    return total_cost;
+}
+
+// Égalité de coûts calculés dans des ordres de sommation différents
+bool sameCost(double a, double b) {
+    return std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(b));
+}
+
+struct CheckResult {
+    std::string check;
+    std::string instance_name;
+    bool passed;
+    std::string detail;
+};
+
+// MedoidsDP qui compte les vecteurs de coûts calculés : un par case remplie hors ligne 0 (mode non borné)
+class CountingMedoidsDP : public MedoidsDP {
+public:
+    std::atomic<size_t> costVectors{0};
+
+protected:
+    void clusterCostsBefore(uint i, vector<double>& v) override {
+        costVectors++;
+        MedoidsDP::clusterCostsBefore(i, v);
+    }
+};
+
+// Vérifications de correction : chaque optimisation est comparée à une référence calculée
+// indépendamment, sur les petites instances (code de sortie 1 si une vérification échoue)
+class VerificationSuite : public Benchmark {
+private:
+    typedef void (VerificationSuite::*Check)(const std::string&);
+
+    std::vector<std::string> instance_files;
+    std::string selected; // "" : toutes les vérifications
+    std::vector<CheckResult> results;
+
+    void record(const std::string& check, const std::string& instance_file, bool passed, const std::string& detail) {
+        results.push_back(CheckResult{check, std::filesystem::path(instance_file).stem(), passed, detail});
+        std::cout << (passed ? "  ✓ " : "  ✗ ") << results.back().instance_name << ": " << detail << std::endl;
+    }
+
+    // update() contre un solve complet des points mis à jour : même coût, et seules les cases
+    // annoncées par getUpdateStats() recalculées (insertion après le dernier point, puis au milieu)
+    void checkUpdate(const std::string& instance_file) {
+        MedoidsDP probe;
+        std::vector<double> points;
+        size_t N, D, K;
+        {
+            QuietOutput quiet;
+            probe.import(instance_file);
+            probe.setNbClusters();
+            N = probe.getNbPoints();
+            D = probe.getDimension();
+            K = probe.getNbClusters();
+            points = probe.getPoints();
+        }
+        double max_x = points[0];
+        for (size_t i = 0; i < N; i++) max_x = std::max(max_x, points[i * D]);
+
+        struct Scenario {
+            std::string name;
+            std::vector<double> inserted;
+            std::vector<size_t> removed;
+        };
+        std::vector<double> last(points.end() - D, points.end());
+        last[0] = max_x + 1.0;
+        std::vector<double> middle(points.begin() + N / 2 * D, points.begin() + (N / 2 + 1) * D);
+        std::vector<Scenario> scenarios = {{"fin", last, {}}, {"milieu", middle, {N / 4}}};
+
+        for (const Scenario& scenario : scenarios) {
+            CountingMedoidsDP updated;
+            MedoidsDP fresh;
+            UpdateStats stats;
+            size_t counted = 0, updated_N;
+            {
+                QuietOutput quiet;
+                updated.setPoints(points.data(), N, D, D);
+                updated.setNbClusters(K);
+                updated.solve();
+                // Vecteurs de coûts du seul remplissage (le backtracking en calcule un par ligne)
+                updated.setFillHooks([&updated]() { updated.costVectors = 0; },
+                                     [&updated, &counted]() { counted = updated.costVectors; });
+                updated.update(scenario.inserted, scenario.removed);
+                stats = updated.getUpdateStats();
+                updated_N = updated.getNbPoints();
+
+                fresh.setPoints(updated.getPoints().data(), updated_N, D, D);
+                fresh.setNbClusters(K);
+                fresh.solve();
+            }
 
-    // Évalue une solution sur le critère k-medoids (distances carrées)
-    double evaluateOnMedoids(const std::vector<double>& points,
-                             const std::vector<size_t>& solution,
-                             size_t N, size_t D, size_t K) {
-        double total_cost = 0.0;
+            // La ligne 0 est remplie par clusterCost, sans vecteur de coûts
+            size_t expected = stats.recomputedCells - (updated_N - stats.firstChanged);
+            bool same_cost = updated.getSolutionCost() == fresh.getSolutionCost();
+            std::ostringstream detail;
+            detail << std::setprecision(17) << scenario.name << ": coût " << updated.getSolutionCost()
+                   << (same_cost ? " = " : " ≠ ") << fresh.getSolutionCost() << ", " << counted
+                   << " cases recalculées hors ligne 0 (annoncées " << expected << ", complet " << stats.fullCells << ")";
+            record("update", instance_file, same_cost && counted == expected, detail.str());
+        }
 
-        for (size_t k = 1; k <= K; k++) {
-            std::vector<size_t> cluster_points;
-            for (size_t i = 0; i < N; i++) {
-                if (solution[i] == k) {
-                    cluster_points.push_back(i);
+        // Mise à jour refusée (K - 1 points restants) : points, solution et coût inchangés
+        if (K < 2) return;
+        MedoidsDP rejected;
+        std::vector<size_t> removed(N - K + 1);
+        std::iota(removed.begin(), removed.end(), 0);
+        bool accepted;
+        {
+            QuietOutput quiet;
+            rejected.setPoints(points.data(), N, D, D);
+            rejected.setNbClusters(K);
+            rejected.solve();
+            std::vector<double> before_points = rejected.getPoints();
+            std::vector<size_t> before_solution = rejected.getSolution();
+            double before_cost = rejected.getSolutionCost();
+            accepted = rejected.update({}, removed)
+                       || rejected.getNbPoints() != N || rejected.getPoints() != before_points
+                       || rejected.getSolution() != before_solution || rejected.getSolutionCost() != before_cost;
+        }
+        record("update", instance_file, !accepted, accepted ? "refus: solveur modifié par une mise à jour invalide"
+                                                            : "refus: solveur inchangé après une mise à jour invalide");
+    }
+
+    // FusedDP contre MedoidsDP et MedianDP résolus séparément (grille K du benchmark) : mêmes coûts optimaux,
+    // et coûts croisés égaux à ceux des deux partitions de FusedDP réévaluées par force brute ; réduction
+    // des points et options héritées non prises en charge refusées
+    void checkFused(const std::string& instance_file) {
+        // Réduction des points refusée : aucune solution rendue
+        FusedDP reduced;
+        {
+            QuietOutput quiet;
+            reduced.import(instance_file);
+            reduced.setNbClusters(std::min<size_t>(2, reduced.getNbPoints()));
+            reduced.setPointReduction(true);
+            reduced.solve();
+        }
+        bool rejected = reduced.getSolutionIntervals().empty();
+        record("fused", instance_file, rejected, rejected ? "réduction des points refusée, aucune solution"
+                                                          : "réduction des points acceptée");
+
+        // Options héritées non appliquées par le balayage conjoint : solve sans solution ; points d'entrée
+        // du remplissage générique refusés
+        std::vector<std::pair<std::string, std::function<void(FusedDP&)>>> options = {
+            {"précision mixte", [](FusedDP& solver) { solver.setMixedPrecision(true); }},
+            {"budget mémoire", [](FusedDP& solver) { solver.setMemoryBudget(1); }},
+            {"tuiles", [](FusedDP& solver) { solver.setFillTiling(true); }},
+            {"pipeline", [](FusedDP& solver) { solver.setWavefrontFill(true); }},
+            {"cache des coûts", [](FusedDP& solver) { solver.setCostCacheCapacity(1024); }},
+        };
+        std::vector<std::string> accepted;
+        for (const auto& option : options) {
+            FusedDP solver;
+            {
+                QuietOutput quiet;
+                solver.import(instance_file);
+                solver.setNbClusters(std::min<size_t>(2, solver.getNbPoints()));
+                option.second(solver);
+                solver.solve();
+            }
+            if (!solver.getSolutionIntervals().empty()) accepted.push_back(option.first);
+        }
+        FusedDP generic;
+        {
+            QuietOutput quiet;
+            generic.import(instance_file);
+            generic.setNbClusters(std::min<size_t>(2, generic.getNbPoints()));
+            if (generic.solveWithin(std::chrono::steady_clock::time_point::max()).optimal) accepted.push_back("solveWithin");
+            if (!generic.getSolutionIntervals().empty()) accepted.push_back("solveWithin (solution)");
+            generic.solve();
+            if (generic.update({}, {}) || generic.solveForClusters(1)) accepted.push_back("update/solveForClusters");
+        }
+        std::ostringstream detail;
+        detail << "options non prises en charge refusées";
+        for (const std::string& option : accepted) detail << ", " << option << " accepté";
+        record("fused", instance_file, accepted.empty(), detail.str());
+
+        for (size_t K : DEFAULT_K_VALUES) {
+            MedoidsDP medoids;
+            MedianDP median;
+            FusedDP fused;
+            {
+                QuietOutput quiet;
+                for (SolverDP* solver : std::initializer_list<SolverDP*>{&medoids, &median, &fused}) {
+                    solver->import(instance_file);
+                    solver->setNbClusters(K);
+                }
+                if (K >= medoids.getNbPoints()) return;
+                medoids.solve();
+                median.solve();
+                fused.solve();
+            }
+
+            size_t N = fused.getNbPoints(), D = fused.getDimension();
+            const std::vector<double>& points = fused.getPoints();
+            const FusedDP::CrossCosts& cross = fused.getCrossCosts();
+            double medoids_on_median = evaluatePartition(points, fused.getMedoidsSolution(), N, D, K, false);
+            double median_on_medoids = evaluatePartition(points, fused.getMedianSolution(), N, D, K, true);
+
+            bool passed = sameCost(cross.medoidsOnMedoids, medoids.getSolutionCost())
+                          && sameCost(cross.medianOnMedian, median.getSolutionCost())
+                          && sameCost(cross.medoidsOnMedoids, evaluatePartition(points, fused.getMedoidsSolution(), N, D, K, true))
+                          && sameCost(cross.medianOnMedian, evaluatePartition(points, fused.getMedianSolution(), N, D, K, false))
+                          && sameCost(cross.medoidsOnMedian, medoids_on_median)
+                          && sameCost(cross.medianOnMedoids, median_on_medoids);
+            std::ostringstream detail;
+            detail << std::setprecision(10) << "K=" << K << ": medoids " << cross.medoidsOnMedoids << " / "
+                   << medoids.getSolutionCost() << ", median " << cross.medianOnMedian << " / "
+                   << median.getSolutionCost() << ", croisés " << cross.medoidsOnMedian << " / " << medoids_on_median
+                   << " et " << cross.medianOnMedoids << " / " << median_on_medoids;
+            record("fused", instance_file, passed, detail.str());
+        }
+    }
+
+    // Réduction des points sur l'instance complétée de doublons (un point sur trois) et de points dominés
+    // (un point sur quatre décalé) : doublons regroupés = même coût que sans réduction, filtre de dominance =
+    // même coût qu'un solve sans réduction des seuls points non dominés (filtre par force brute en O(N²)),
+    // et tous les points étiquetés, les doublons ensemble ; k-medoids et p-median
+    void checkReduction(const std::string& instance_file) {
+        std::vector<double> base;
+        size_t N, D;
+        {
+            QuietOutput quiet;
+            MedoidsDP probe;
+            probe.import(instance_file);
+            base = probe.getPoints();
+            N = probe.getNbPoints();
+            D = probe.getDimension();
+        }
+        if (D != 2) return;
+
+        std::vector<double> points(base);
+        for (size_t i = 0; i < N; i += 3) points.insert(points.end(), base.begin() + i * D, base.begin() + (i + 1) * D);
+        for (size_t i = 1; i < N; i += 4) {
+            points.push_back(base[i * D] + 1.0);
+            points.push_back(base[i * D + 1] + 1.0);
+        }
+        size_t total = points.size() / D;
+
+        std::vector<double> kept;
+        for (size_t p = 0; p < total; p++) {
+            bool dominated = false;
+            for (size_t q = 0; q < total && !dominated; q++) {
+                dominated = points[q * D] <= points[p * D] && points[q * D + 1] <= points[p * D + 1]
+                            && (points[q * D] < points[p * D] || points[q * D + 1] < points[p * D + 1]);
+            }
+            if (!dominated) kept.insert(kept.end(), points.begin() + p * D, points.begin() + (p + 1) * D);
+        }
+        // Points distincts parmi les non dominés : colonnes de la DP réduite, au moins K
+        std::vector<std::pair<double, double>> distinct_kept;
+        for (size_t p = 0; p < kept.size() / D; p++) distinct_kept.emplace_back(kept[p * D], kept[p * D + 1]);
+        std::sort(distinct_kept.begin(), distinct_kept.end());
+        size_t distinct = std::unique(distinct_kept.begin(), distinct_kept.end()) - distinct_kept.begin();
+        if (distinct < 3) return;
+        size_t K = std::min<size_t>(4, distinct - 1);
+
+        for (bool median : {false, true}) {
+            auto make = [median]() -> std::unique_ptr<SolverDP> {
+                if (median) return std::unique_ptr<SolverDP>(new MedianDP);
+                return std::unique_ptr<SolverDP>(new MedoidsDP);
+            };
+            std::unique_ptr<SolverDP> plain = make(), collapsed = make(), filtered = make(), reference = make();
+            {
+                QuietOutput quiet;
+                plain->setPoints(points.data(), total, D, D);
+                collapsed->setPoints(points.data(), total, D, D);
+                collapsed->setPointReduction(false, true);
+                filtered->setPoints(points.data(), total, D, D);
+                filtered->setPointReduction(true, true);
+                reference->setPoints(kept.data(), kept.size() / D, D, D);
+                for (SolverDP* solver : {plain.get(), collapsed.get(), filtered.get(), reference.get()}) {
+                    solver->setNbClusters(K);
+                    solver->solve();
+                }
+            }
+
+            // Étiquettes de tous les points, identiques pour deux points égaux
+            bool labelled = true;
+            for (SolverDP* solver : {collapsed.get(), filtered.get()}) {
+                const std::vector<double>& sorted = solver->getPoints();
+                const std::vector<size_t>& labels = solver->getSolution();
+                labelled = labelled && labels.size() == total;
+                for (size_t i = 0; labelled && i < total; i++) {
+                    labelled = labels[i] >= 1 && labels[i] <= K;
+                    if (i > 0 && sorted[i * D] == sorted[(i - 1) * D] && sorted[i * D + 1] == sorted[(i - 1) * D + 1]) {
+                        labelled = labelled && labels[i] == labels[i - 1];
+                    }
                 }
             }
 
-            if (cluster_points.size() <= 1) continue;
+            ReductionStats stats = filtered->getReductionStats();
+            bool passed = labelled && sameCost(collapsed->getSolutionCost(), plain->getSolutionCost())
+                          && sameCost(filtered->getSolutionCost(), reference->getSolutionCost())
+                          && stats.originalPoints - stats.dominated == kept.size() / D;
+            std::ostringstream detail;
+            detail << std::setprecision(10) << (median ? "median" : "medoids") << " K=" << K << ", " << total
+                   << " points: doublons " << collapsed->getSolutionCost() << " / " << plain->getSolutionCost()
+                   << ", dominance " << filtered->getSolutionCost() << " / " << reference->getSolutionCost() << " ("
+                   << stats.originalPoints - stats.dominated << " / " << kept.size() / D << " points non dominés)"
+                   << (labelled ? "" : ", étiquettes incomplètes");
+            record("reduction", instance_file, passed, detail.str());
+        }
+    }
+
+    // Démarrage à chaud contre solve à froid, k-medoids et p-median, sans borne et bornés à L = 4N/K, démarrés
+    // sur les intervalles k-means puis sur K intervalles égaux (fenêtre 2, le certificat fait l'essentiel) :
+    // mêmes coûts et mêmes partitions (même départage)
+    void checkWarm(const std::string& instance_file) {
+        KMeansDP kmeans;
+        {
+            QuietOutput quiet;
+            kmeans.import(instance_file);
+            kmeans.setNbClusters();
+            if (kmeans.getNbClusters() >= kmeans.getNbPoints()) return;
+            kmeans.solve();
+        }
+        size_t N = kmeans.getNbPoints(), K = kmeans.getNbClusters();
+        std::vector<std::pair<uint, uint>> uniform;
+        for (size_t c = 0; c < K; c++) {
+            uniform.emplace_back(static_cast<uint>(c * N / K), static_cast<uint>((c + 1) * N / K - 1));
+        }
+        const std::vector<std::pair<std::string, std::vector<std::pair<uint, uint>>>> starts = {
+            {"k-means", kmeans.getSolutionIntervals()}, {"égaux", uniform}};
 
-            // Trouver le médoïde optimal pour ce cluster
-            double min_cost = std::numeric_limits<double>::max();
-            for (size_t medoid_idx : cluster_points) {
-                double cost = 0.0;
-                for (size_t point_idx : cluster_points) {
-                    if (point_idx != medoid_idx) {
-                        double dist_sq = 0.0;
-                        for (size_t d = 0; d < D; d++) {
-                            double diff = points[point_idx * D + d] - points[medoid_idx * D + d];
-                            dist_sq += diff * diff;
+        for (bool median : {false, true}) {
+            for (size_t L : {N, (4 * N + K - 1) / K}) {
+                for (const auto& start : starts) {
+                    std::unique_ptr<SolverDP> cold, warm;
+                    if (median) {
+                        cold.reset(new MedianDP);
+                        warm.reset(new MedianDP);
+                    } else {
+                        cold.reset(new MedoidsDP);
+                        warm.reset(new MedoidsDP);
+                    }
+                    {
+                        QuietOutput quiet;
+                        for (SolverDP* solver : {cold.get(), warm.get()}) {
+                            solver->import(instance_file);
+                            solver->setNbClusters(K);
+                            solver->setClusterLengthBounds(static_cast<uint>(L));
                         }
-                        cost += dist_sq;  // Distance carrée pour k-medoids
+                        warm->setWarmStart(start.second, N, 2);
+                        cold->solve();
+                        warm->solve();
+                    }
+
+                    WarmStartStats stats = warm->getWarmStartStats();
+                    bool passed = warm->getSolutionCost() == cold->getSolutionCost()
+                                  && warm->getSolution() == cold->getSolution();
+                    std::ostringstream detail;
+                    detail << std::setprecision(17) << (median ? "median" : "medoids") << " L=" << L << ", départ "
+                           << start.first << ": coût " << warm->getSolutionCost()
+                           << (passed ? " = " : " ≠ ") << cold->getSolutionCost() << " ("
+                           << stats.windowCosts + stats.widenedCosts << " coûts exacts et " << stats.boundChecks
+                           << " bornes pour " << stats.fullCosts << " splits)";
+                    record("warm", instance_file, passed, detail.str());
+                }
+            }
+        }
+    }
+
+    // Taille des clusters bornée : pour L de la plus petite borne admissible à 4N/K, avec et sans taille
+    // minimale, coût de MedoidsDP et MedianDP égal à celui de la DP scalaire de référence, partition
+    // réévaluée au même coût et intervalles dans les bornes (L = N : coût du solve sans borne)
+    void checkBounded(const std::string& instance_file) {
+        size_t N, K;
+        {
+            QuietOutput quiet;
+            MedoidsDP probe;
+            probe.import(instance_file);
+            probe.setNbClusters();
+            N = probe.getNbPoints();
+            K = probe.getNbClusters();
+        }
+        if (K >= N) return;
+
+        size_t shortest = (N + K - 1) / K;
+        for (bool median : {false, true}) {
+            for (size_t L : {shortest, 2 * shortest, 4 * shortest, N}) {
+                for (size_t minimum : {size_t(1), std::max<size_t>(1, N / (2 * K))}) {
+                    if (L > N || (L == N && minimum > 1)) continue;
+                    std::unique_ptr<SolverDP> solver;
+                    if (median) solver.reset(new MedianDP);
+                    else solver.reset(new MedoidsDP);
+                    {
+                        QuietOutput quiet;
+                        solver->import(instance_file);
+                        solver->setNbClusters(K);
+                        solver->setClusterLengthBounds(L == N ? 0 : static_cast<uint>(L), static_cast<uint>(minimum));
+                        solver->solve();
+                    }
+
+                    const std::vector<double>& points = solver->getPoints();
+                    size_t D = solver->getDimension();
+                    double reference = referenceIntervalCost(points, N, D, K, L, minimum, !median);
+                    bool within = solver->getSolutionIntervals().size() == K;
+                    for (const auto& interval : solver->getSolutionIntervals()) {
+                        size_t length = interval.second - interval.first + 1;
+                        within = within && length >= minimum && length <= L;
                     }
+                    double reevaluated = evaluatePartition(points, solver->getSolution(), N, D, K, !median);
+                    bool passed = within && sameCost(solver->getSolutionCost(), reference)
+                                  && sameCost(reevaluated, reference);
+                    std::ostringstream detail;
+                    detail << std::setprecision(10) << (median ? "median" : "medoids") << " K=" << K << " L=" << L
+                           << " min=" << minimum << ": coût " << solver->getSolutionCost() << " / référence "
+                           << reference << " (partition " << reevaluated << ")"
+                           << (within ? "" : ", intervalles hors bornes");
+                    record("bounded", instance_file, passed, detail.str());
                 }
-                min_cost = std::min(min_cost, cost);
             }
-            total_cost += min_cost;
         }
+    }
+
+    // Cache des coûts d'intervalle : avec une capacité de N entrées (évictions) puis de N² entrées, mêmes coûts et
+    // mêmes partitions que sans cache, sans borne et bornés à L = 4N/K, et cache effectivement consulté
+    void checkCache(const std::string& instance_file) {
+        size_t N, K;
+        {
+            QuietOutput quiet;
+            MedoidsDP probe;
+            probe.import(instance_file);
+            probe.setNbClusters();
+            N = probe.getNbPoints();
+            K = probe.getNbClusters();
+        }
+        if (K >= N) return;
+
+        for (bool median : {false, true}) {
+            for (size_t L : {N, (4 * N + K - 1) / K}) {
+                for (size_t capacity : {N, N * N}) {
+                    std::unique_ptr<SolverDP> plain, cached;
+                    if (median) {
+                        plain.reset(new MedianDP);
+                        cached.reset(new MedianDP);
+                    } else {
+                        plain.reset(new MedoidsDP);
+                        cached.reset(new MedoidsDP);
+                    }
+                    {
+                        QuietOutput quiet;
+                        for (SolverDP* solver : {plain.get(), cached.get()}) {
+                            solver->import(instance_file);
+                            solver->setNbClusters(K);
+                            solver->setClusterLengthBounds(L == N ? 0 : static_cast<uint>(L));
+                        }
+                        cached->setCostCacheCapacity(capacity);
+                        plain->solve();
+                        cached->solve();
+                    }
 
-        return total_cost;
+                    IntervalCostCache::Stats stats = cached->getCostCacheStats();
+                    bool passed = cached->getSolutionCost() == plain->getSolutionCost()
+                                  && cached->getSolution() == plain->getSolution() && stats.hits + stats.misses > 0;
+                    std::ostringstream detail;
+                    detail << std::setprecision(17) << (median ? "median" : "medoids") << " L=" << L << ", capacité "
+                           << capacity << ": coût " << cached->getSolutionCost() << " / " << plain->getSolutionCost()
+                           << " (" << stats.hits << " succès, " << stats.misses << " défauts, " << stats.evictions
+                           << " évictions)";
+                    record("cache", instance_file, passed, detail.str());
+                }
+            }
+        }
     }
 
-    // Évalue une solution sur le critère p-median (distances simples)
-    double evaluateOnMedian(const std::vector<double>& points,
-                            const std::vector<size_t>& solution,
-                            size_t N, size_t D, size_t K) {
-        double total_cost = 0.0;
+    // Noyau argmin des splits contre une boucle scalaire (plus petit indice à égalité) sur toutes les longueurs
+    // 0..N+7, valeurs entières peu nombreuses (nombreuses égalités) et sentinelles max(), puis MedoidsDP et
+    // MedianDP sans borne (balayage complet des splits) contre la DP scalaire de référence
+    void checkArgmin(const std::string& instance_file) {
+        size_t N, K;
+        std::unique_ptr<SolverDP> solvers[2] = {std::unique_ptr<SolverDP>(new MedoidsDP),
+                                                std::unique_ptr<SolverDP>(new MedianDP)};
+        {
+            QuietOutput quiet;
+            for (auto& solver : solvers) {
+                solver->import(instance_file);
+                solver->setNbClusters();
+            }
+            N = solvers[0]->getNbPoints();
+            K = solvers[0]->getNbClusters();
+        }
 
-        for (size_t k = 1; k <= K; k++) {
-            std::vector<size_t> cluster_points;
-            for (size_t i = 0; i < N; i++) {
-                if (solution[i] == k) {
-                    cluster_points.push_back(i);
+        const double sentinel = std::numeric_limits<double>::max();
+        std::mt19937 generator(static_cast<unsigned>(N));
+        std::uniform_int_distribution<int> level(0, 7);
+        size_t mismatches = 0, lengths = 0;
+        for (size_t len = 0; len <= N + 7; len++, lengths++) {
+            std::vector<double> a(len), b(len);
+            for (size_t i = 0; i < len; i++) {
+                a[i] = level(generator) == 0 ? sentinel : static_cast<double>(level(generator));
+                b[i] = static_cast<double>(level(generator));
+            }
+            ArgminResult expected{sentinel, 0};
+            for (size_t i = 0; i < len; i++) {
+                if (a[i] + b[i] < expected.value) expected = ArgminResult{a[i] + b[i], i};
+            }
+            ArgminResult found = argminSum(a.data(), b.data(), len);
+            if (found.value != expected.value || found.index != expected.index) mismatches++;
+        }
+        std::ostringstream kernel;
+        kernel << "noyau: " << mismatches << " écarts sur " << lengths << " longueurs";
+        record("argmin", instance_file, mismatches == 0, kernel.str());
+
+        if (K >= N) return;
+        for (size_t m = 0; m < 2; m++) {
+            {
+                QuietOutput quiet;
+                solvers[m]->solve();
+            }
+            double reference = referenceIntervalCost(solvers[m]->getPoints(), N, solvers[m]->getDimension(), K, N, 1, m == 0);
+            std::ostringstream detail;
+            detail << std::setprecision(10) << (m == 0 ? "medoids" : "median") << " K=" << K << ": coût "
+                   << solvers[m]->getSolutionCost() << " / référence " << reference;
+            record("argmin", instance_file, sameCost(solvers[m]->getSolutionCost(), reference), detail.str());
+        }
+    }
+
+    // Mode hors mémoire (budget d'un octet, lignes déversées dans le répertoire temporaire) : mêmes coûts et mêmes
+    // partitions qu'en mémoire, sans borne et bornés à L = 4N/K
+    void checkOutOfCore(const std::string& instance_file) {
+        size_t N, K;
+        {
+            QuietOutput quiet;
+            MedoidsDP probe;
+            probe.import(instance_file);
+            probe.setNbClusters();
+            N = probe.getNbPoints();
+            K = probe.getNbClusters();
+        }
+        if (K >= N) return;
+
+        for (bool median : {false, true}) {
+            for (size_t L : {N, (4 * N + K - 1) / K}) {
+                std::unique_ptr<SolverDP> memory, spilled;
+                if (median) {
+                    memory.reset(new MedianDP);
+                    spilled.reset(new MedianDP);
+                } else {
+                    memory.reset(new MedoidsDP);
+                    spilled.reset(new MedoidsDP);
+                }
+                {
+                    QuietOutput quiet;
+                    for (SolverDP* solver : {memory.get(), spilled.get()}) {
+                        solver->import(instance_file);
+                        solver->setNbClusters(K);
+                        solver->setClusterLengthBounds(L == N ? 0 : static_cast<uint>(L));
+                    }
+                    spilled->setMemoryBudget(1, std::filesystem::temp_directory_path().string());
+                    memory->solve();
+                    spilled->solve();
+                }
+
+                SolverStats stats = spilled->getStats();
+                bool passed = stats.outOfCore && stats.spilledBytes > 0
+                              && spilled->getSolutionCost() == memory->getSolutionCost()
+                              && spilled->getSolution() == memory->getSolution();
+                std::ostringstream detail;
+                detail << std::setprecision(17) << (median ? "median" : "medoids") << " L=" << L << ": coût "
+                       << spilled->getSolutionCost() << " / " << memory->getSolutionCost() << " ("
+                       << (stats.outOfCore ? "" : "pas ") << "hors mémoire, " << stats.spilledBytes << " octets déversés)";
+                record("out-of-core", instance_file, passed, detail.str());
+            }
+        }
+    }
+
+    // Reprise : un solve annulé après la moitié des lignes laisse un point de reprise (écrit après chaque ligne) ;
+    // la reprise restaure des lignes et donne le coût et la partition d'un solve complet, et le même point de
+    // reprise est rejeté pour K + 1 clusters ; k-medoids et p-median, sans borne et bornés à L = 4N/K
+    void checkResume(const std::string& instance_file) {
+        size_t N, K;
+        {
+            QuietOutput quiet;
+            MedoidsDP probe;
+            probe.import(instance_file);
+            probe.setNbClusters();
+            N = probe.getNbPoints();
+            K = probe.getNbClusters();
+        }
+        if (K + 1 >= N) return;
+        std::string path = (std::filesystem::temp_directory_path()
+                            / (std::filesystem::path(instance_file).stem().string() + "_verification.ckpt")).string();
+
+        for (bool median : {false, true}) {
+            for (size_t L : {N, (4 * N + K - 1) / K}) {
+                std::unique_ptr<SolverDP> full, interrupted, resumed, other;
+                for (auto* solver : {&full, &interrupted, &resumed, &other}) {
+                    if (median) solver->reset(new MedianDP);
+                    else solver->reset(new MedoidsDP);
                 }
+                bool accepted, rejected;
+                CancellationToken token;
+                {
+                    QuietOutput quiet;
+                    for (SolverDP* solver : {full.get(), interrupted.get(), resumed.get(), other.get()}) {
+                        solver->import(instance_file);
+                        solver->setNbClusters(solver == other.get() ? K + 1 : K);
+                        solver->setClusterLengthBounds(L == N ? 0 : static_cast<uint>(L));
+                    }
+                    full->solve();
+
+                    interrupted->setCheckpoint(path, 0.0);
+                    interrupted->solveWithin(std::chrono::steady_clock::time_point::max(), &token,
+                                             [&token, K](const SolveProgress& progress) {
+                                                 if (progress.rowsCompleted >= (K + 1) / 2) token.cancel();
+                                             });
+                    accepted = resumed->resume(path);
+                    rejected = !other->resume(path);
+                }
+                std::filesystem::remove(path);
+
+                bool passed = accepted && rejected && resumed->getResumedRows() >= 1 && resumed->getResumedRows() < K
+                              && resumed->getSolutionCost() == full->getSolutionCost()
+                              && resumed->getSolution() == full->getSolution();
+                std::ostringstream detail;
+                detail << std::setprecision(17) << (median ? "median" : "medoids") << " L=" << L << ": reprise "
+                       << (accepted ? "acceptée" : "rejetée") << " après " << resumed->getResumedRows() << " lignes sur "
+                       << K << ", coût " << resumed->getSolutionCost() << " / " << full->getSolutionCost()
+                       << (rejected ? "" : ", point de reprise accepté pour K + 1");
+                record("resume", instance_file, passed, detail.str());
             }
+        }
+    }
 
-            if (cluster_points.size() <= 1) continue;
+    // FasterPAM, k-medoids et p-median, initialisations k-means++ et BUILD : coût égal à celui des médoïdes rendus
+    // recalculé par force brute, et optimum local pour les échanges, vérifié en évaluant chacun des K(N-K)
+    // échanges (médoïde, non-médoïde) par force brute : aucun ne baisse le coût (tolérance relative 1e-9)
+    void checkPam(const std::string& instance_file) {
+        for (bool squared : {true, false}) {
+            for (PamSeeding seeding : {PamSeeding::KMEANS_PLUS_PLUS, PamSeeding::BUILD}) {
+                FasterPAM pam(squared);
+                {
+                    QuietOutput quiet;
+                    pam.import(instance_file);
+                    pam.setNbClusters();
+                    if (pam.getNbClusters() >= pam.getNbPoints()) return;
+                    pam.setSeeding(seeding);
+                    pam.solve();
+                }
 
-            // Trouver le médian optimal pour ce cluster
-            double min_cost = std::numeric_limits<double>::max();
-            for (size_t median_idx : cluster_points) {
-                double cost = 0.0;
-                for (size_t point_idx : cluster_points) {
-                    if (point_idx != median_idx) {
-                        double dist_sq = 0.0;
-                        for (size_t d = 0; d < D; d++) {
-                            double diff = points[point_idx * D + d] - points[median_idx * D + d];
-                            dist_sq += diff * diff;
+                size_t N = pam.getNbPoints(), D = pam.getDimension();
+                const std::vector<double>& points = pam.getPoints();
+                auto cost = [&](const std::vector<size_t>& medoids) {
+                    double total = 0.0;
+                    for (size_t i = 0; i < N; i++) {
+                        double nearest = std::numeric_limits<double>::max();
+                        for (size_t medoid : medoids) {
+                            double dist_sq = 0.0;
+                            for (size_t d = 0; d < D; d++) {
+                                double diff = points[i * D + d] - points[medoid * D + d];
+                                dist_sq += diff * diff;
+                            }
+                            nearest = std::min(nearest, squared ? dist_sq : std::sqrt(dist_sq));
                         }
-                        cost += sqrt(dist_sq);  // Distance simple pour p-median
+                        total += nearest;
+                    }
+                    return total;
+                };
+
+                std::vector<size_t> medoids = pam.getMedoids();
+                double current = cost(medoids);
+                std::vector<bool> isMedoid(N, false);
+                for (size_t medoid : medoids) isMedoid[medoid] = true;
+                size_t improving = 0, swaps = 0;
+                double best = current;
+                for (size_t m = 0; m < medoids.size(); m++) {
+                    size_t removed = medoids[m];
+                    for (size_t candidate = 0; candidate < N; candidate++) {
+                        if (isMedoid[candidate]) continue;
+                        medoids[m] = candidate;
+                        double swapped = cost(medoids);
+                        swaps++;
+                        if (swapped < current - 1e-9 * current) improving++;
+                        best = std::min(best, swapped);
                     }
+                    medoids[m] = removed;
+                }
+
+                bool passed = sameCost(pam.getSolutionCost(), current) && improving == 0;
+                std::ostringstream detail;
+                detail << std::setprecision(10) << (squared ? "medoids" : "median") << ", "
+                       << (seeding == PamSeeding::BUILD ? "BUILD" : "k-means++") << ": coût " << pam.getSolutionCost()
+                       << " / recalculé " << current << ", " << improving << " échanges améliorants sur " << swaps
+                       << " (meilleur " << best << ", " << pam.getStats().passes << " passes)";
+                record("pam", instance_file, passed, detail.str());
+            }
+        }
+    }
+
+    // Solve borné : instance répliquée jusqu'à 2000 points (copies décalées sur la première coordonnée),
+    // k-medoids et p-median, sans borne de taille avec K = 2 puis avec K = N/25 et L = 4N/K. Sous une
+    // échéance de 20 ms, solveWithin rend au plus 100 ms après l'échéance K intervalles couvrant les
+    // points dans les bornes (interrompu, ou optimal si le solve a tenu dans le budget)
+    void checkDeadline(const std::string& instance_file) {
+        const double budget = 0.02, overshoot = 0.1;
+        std::vector<double> points;
+        size_t D;
+        {
+            QuietOutput quiet;
+            MedoidsDP probe;
+            probe.import(instance_file);
+            points = probe.getPoints();
+            D = probe.getDimension();
+        }
+        size_t count = D > 0 ? points.size() / D : 0;
+        if (count == 0) return;
+
+        double lowest = points[0], highest = points[0];
+        for (size_t i = 0; i < count; i++) {
+            lowest = std::min(lowest, points[i * D]);
+            highest = std::max(highest, points[i * D]);
+        }
+        size_t copies = (2000 + count - 1) / count;
+        std::vector<double> replicated;
+        for (size_t copy = 0; copy < copies; copy++) {
+            for (size_t i = 0; i < count * D; i++) {
+                replicated.push_back(points[i] + (i % D == 0 ? copy * (highest - lowest + 1.0) : 0.0));
+            }
+        }
+        size_t N = copies * count;
+
+        for (bool median : {false, true}) {
+            for (size_t K : {static_cast<size_t>(2), N / 25}) {
+                size_t L = K == 2 ? N : 4 * N / K;
+                std::unique_ptr<SolverDP> solver;
+                if (median) solver.reset(new MedianDP);
+                else solver.reset(new MedoidsDP);
+
+                SolveOutcome outcome;
+                double seconds;
+                {
+                    QuietOutput quiet;
+                    solver->setPoints(replicated.data(), N, D, D);
+                    solver->setNbClusters(K);
+                    solver->setClusterLengthBounds(L == N ? 0 : static_cast<uint>(L));
+                    auto start = std::chrono::steady_clock::now();
+                    outcome = solver->solveWithin(start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                            std::chrono::duration<double>(budget)));
+                    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                }
+
+                const auto& intervals = solver->getSolutionIntervals();
+                bool within = intervals.size() == K;
+                size_t next = 0;
+                for (const auto& interval : intervals) {
+                    size_t length = interval.second - interval.first + 1;
+                    within = within && interval.first == next && length <= L;
+                    next = interval.second + 1;
+                }
+                within = within && next == N;
+
+                bool passed = seconds <= budget + overshoot && within && (outcome.optimal || outcome.deadlineExpired);
+                std::ostringstream detail;
+                detail << std::fixed << std::setprecision(4) << (median ? "median" : "medoids") << " N=" << N
+                       << " K=" << K << " L=" << L << ": retour en " << seconds << " s pour " << budget << " s, "
+                       << outcome.rowsCompleted << "/" << K << " lignes"
+                       << (outcome.optimal ? " (optimal)" : outcome.exactCost ? " (repli)" : " (repli, coût estimé)")
+                       << (within ? "" : ", intervalles invalides");
+                record("deadline", instance_file, passed, detail.str());
+            }
+        }
+    }
+
+public:
+    VerificationSuite(const std::vector<std::string>& instances, const std::string& check)
+            : instance_files(instances), selected(check) {}
+
+    void run() override {
+        const std::vector<std::pair<std::string, Check>> checks = {
+            {"argmin", &VerificationSuite::checkArgmin},
+            {"bounded", &VerificationSuite::checkBounded},
+            {"cache", &VerificationSuite::checkCache},
+            {"deadline", &VerificationSuite::checkDeadline},
+            {"fused", &VerificationSuite::checkFused},
+            {"out-of-core", &VerificationSuite::checkOutOfCore},
+            {"pam", &VerificationSuite::checkPam},
+            {"reduction", &VerificationSuite::checkReduction},
+            {"resume", &VerificationSuite::checkResume},
+            {"update", &VerificationSuite::checkUpdate},
+            {"warm", &VerificationSuite::checkWarm},
+        };
+
+        for (const auto& check : checks) {
+            if (!selected.empty() && selected != check.first) continue;
+            std::cout << "Vérification " << check.first << std::endl;
+            for (const std::string& instance_file : instance_files) {
+                try {
+                    (this->*check.second)(instance_file);
+                } catch (const std::exception& e) {
+                    record(check.first, instance_file, false, e.what());
                 }
-                min_cost = std::min(min_cost, cost);
             }
-            total_cost += min_cost;
         }
+        if (results.empty()) std::cerr << "Erreur: aucune vérification exécutée (" << selected << ")" << std::endl;
+    }
+
+    bool allPassed() const {
+        return !results.empty() && std::all_of(results.begin(), results.end(),
+                                               [](const CheckResult& result) { return result.passed; });
+    }
+
+    void writeResults(std::ostream& file) override {
+        file << "check,instance,passed,detail" << std::endl;
+        for (const auto& result : results) {
+            file << result.check << "," << result.instance_name << "," << (result.passed ? 1 : 0) << ",\""
+                 << result.detail << "\"" << std::endl;
+        }
+    }
 
-        return total_cost;
+    void printSummary() override {
+        std::cout << "\n=== VÉRIFICATIONS ===" << std::endl;
+        std::map<std::string, std::pair<size_t, size_t>> by_check;
+        for (const auto& result : results) {
+            by_check[result.check].first += result.passed ? 1 : 0;
+            by_check[result.check].second++;
+        }
+        for (const auto& [check, count] : by_check) {
+            std::cout << check << ": " << count.first << "/" << count.second
+                      << (count.first == count.second ? " ✓" : " ✗") << std::endl;
+        }
     }
+};
+
+class BenchmarkSuite : public Benchmark {
+private:
+    std::vector<std::string> instance_files;
+    std::vector<size_t> K_values;
+    std::vector<BenchmarkResult> results;
+    std::vector<TimingResult> timings;
 
 public:
     BenchmarkSuite(const std::vector<std::string>& instances, const std::vector<size_t>& K_vals)
             : instance_files(instances), K_values(K_vals) {}
 
-    void runBenchmarks() {
+    void run() override {
         std::cout << "=== BENCHMARK SUITE ===" << std::endl;
         std::cout << "Instances: " << instance_files.size() << std::endl;
         std::cout << "K values: ";
         for (size_t k : K_values) std::cout << k << " ";
         std::cout << std::endl << std::endl;
 
+        // Les couples (instance, K) sont indépendants : ils sont résolus en parallèle sur le pool de la
+        // bibliothèque, qui partage les threads OpenMP entre eux, et les résultats gardent l'ordre de soumission.
+        // Au plus getWorkers() solves tournent en même temps : le budget de la matrice des distances est partagé
+        // entre eux (l'empreinte ne croît pas avec le nombre de travaux, hors tables DP) et leurs traces, qui
+        // seraient entremêlées, sont coupées ; la progression passe alors sur std::cerr
+        size_t jobs = instance_files.size() * K_values.size();
+        size_t concurrent = std::max<size_t>(1, std::min(SolverPool::shared().getWorkers(), jobs));
+        size_t budget = DISTANCE_MATRIX_BUDGET / concurrent;
+        std::unique_ptr<QuietOutput> quiet(concurrent > 1 ? new QuietOutput : nullptr);
+        std::ostream& progress = concurrent > 1 ? std::cerr : std::cout;
+
+        std::vector<BenchmarkResult> slots;
+        std::vector<std::future<void>> pending;
+        slots.reserve(jobs);
         for (const std::string& instance_file : instance_files) {
             for (size_t K : K_values) {
-                try {
-                    std::cout << "Testing: " << instance_file << " with K=" << K << std::endl;
-
-                    // Résoudre avec k-medoids
-                    MedoidsDP medoids_solver;
-                    medoids_solver.import(instance_file);
-                    medoids_solver.setNbClusters(); // Utilise la méthode automatique
-                    medoids_solver.solve();
-
-                    // Résoudre avec p-median
-                    MedianDP median_solver;
-                    median_solver.import(instance_file);
-                    median_solver.setNbClusters(); // Utilise la méthode automatique
-                    median_solver.solve();
-
-                    // Préparer les données pour évaluation croisée
-                    size_t N = medoids_solver.getNbPoints();
-                    size_t D = medoids_solver.getDimension();
-                    size_t actual_K = medoids_solver.getNbClusters();
+                progress << "Testing: " << instance_file << " with K=" << K << std::endl;
+                slots.emplace_back();
+                BenchmarkResult* result = &slots.back();
+                pending.push_back(SolverPool::shared().submit([instance_file, result, budget]() {
+                    // Résolution conjointe k-medoids / p-median (distances calculées une seule fois)
+                    FusedDP fused_solver;
+                    fused_solver.import(instance_file);
+                    fused_solver.setNbClusters(); // Utilise la méthode automatique
+                    fused_solver.setDistanceMatrixBudget(budget);
+                    fused_solver.solve();
 
-                    // Accéder aux données via les méthodes publiques
-                    const std::vector<double>& points = medoids_solver.getPoints();
-                    const std::vector<size_t>& medoids_solution = medoids_solver.getSolution();
-                    const std::vector<size_t>& median_solution = median_solver.getSolution();
+                    // Évaluations croisées fournies par le solveur
+                    const FusedDP::CrossCosts& cross = fused_solver.getCrossCosts();
 
-                    // Évaluations croisées
-                    BenchmarkResult result;
-                    result.instance_name = std::filesystem::path(instance_file).stem();
-                    result.N = N;
-                    result.K = actual_K;
+                    result->instance_name = std::filesystem::path(instance_file).stem();
+                    result->N = fused_solver.getNbPoints();
+                    result->K = fused_solver.getNbClusters();
 
-                    result.medoids_on_medoids = evaluateOnMedoids(points, medoids_solution, N, D, actual_K);
-                    result.medoids_on_median = evaluateOnMedian(points, medoids_solution, N, D, actual_K);
-                    result.median_on_medoids = evaluateOnMedoids(points, median_solution, N, D, actual_K);
-                    result.median_on_median = evaluateOnMedian(points, median_solution, N, D, actual_K);
-
-                    results.push_back(result);
-
-                    std::cout << "  ✓ Completed" << std::endl;
-
-                } catch (const std::exception& e) {
-                    std::cerr << "  ✗ Error: " << e.what() << std::endl;
-                }
+                    result->medoids_on_medoids = cross.medoidsOnMedoids;
+                    result->medoids_on_median = cross.medoidsOnMedian;
+                    result->median_on_medoids = cross.medianOnMedoids;
+                    result->median_on_median = cross.medianOnMedian;
+                }));
             }
         }
-    }
 
-    void exportResults(const std::string& output_file = "benchmark_results.csv") {
-        std::ofstream file(output_file);
-        if (!file.is_open()) {
-            std::cerr << "Erreur: impossible de créer " << output_file << std::endl;
-            return;
+        for (size_t i = 0; i < pending.size(); i++) {
+            try {
+                pending[i].get();
+                results.push_back(slots[i]);
+                progress << "  ✓ Completed " << slots[i].instance_name << std::endl;
+            } catch (const std::exception& e) {
+                std::cerr << "  ✗ Error: " << e.what() << std::endl;
+            }
         }
+    }
 
+    void writeResults(std::ostream& file) override {
         // Header
         file << "instance,N,K,medoids_on_medoids,medoids_on_median,median_on_medoids,median_on_median,";
         file << "ratio_medoids_median_on_medoids,ratio_median_medoids_on_median" << std::endl;
@@ -188,12 +2457,9 @@ public:
                  << ratio_medoids_median_on_medoids << ","
                  << ratio_median_medoids_on_median << std::endl;
         }
-
-        file.close();
-        std::cout << "✓ Résultats exportés: " << output_file << std::endl;
     }
 
-    void printSummaryByN() {
+    void printSummary() override {
         // Regrouper par taille N
         std::map<size_t, std::vector<BenchmarkResult*>> by_N;
         for (auto& result : results) {
@@ -220,59 +2486,450 @@ public:
                       << std::fixed << std::setprecision(3) << avg_ratio_median_medoids << std::endl;
         }
     }
-};
 
-int main(int argc, char** argv) {
-    std::cout << "===============================================" << std::endl;
-    std::cout << "  BENCHMARK CROSS-VALIDATION SOLVERS" << std::endl;
-    std::cout << "===============================================" << std::endl;
+    // Temps de solve de chaque couple (instance, K), un solve après l'autre (pas sur le pool :
+    // les solves simultanés se gêneraient), après un solve de chauffe non mesuré
+    void runTimings(size_t repetitions) {
+        timings.clear();
+        forEachInstance(instance_files, [&](const std::string& instance_file) {
+            MedoidsDP probe;
+            probe.import(instance_file);
 
-    // Configuration par défaut
-    std::vector<std::string> instances = {
-            "data/very_small_instance_3.txt",
-            "data/very_small_instance_2.txt",
-            "data/very_small_instance_4.csv",
-            "data/very_small_instance_1.txt"
-    };
+            for (size_t K : K_values) {
+                TimingResult timing;
+                timing.instance_file = instance_file;
+                timing.instance_name = std::filesystem::path(instance_file).stem();
+                timing.N = probe.getNbPoints();
+                timing.K = K;
+                std::cout << "Timing: " << timing.instance_name << " with K=" << K << std::endl;
 
-    std::vector<size_t> K_values = {2, 3, 4, 5};
+                for (size_t r = 0; r <= repetitions; r++) {
+                    FusedDP solver;
+                    solver.setPoints(probe.getPoints().data(), probe.getNbPoints(), probe.getDimension(),
+                                     probe.getDimension());
+                    solver.setNbClusters(K);
+                    solver.setDistanceMatrixBudget(DISTANCE_MATRIX_BUDGET);
 
-    // Parsing arguments simples
-    if (argc > 1) {
-        std::string data_dir = argv[1];
-        instances.clear();
+                    QuietOutput quiet;
+                    auto start = std::chrono::steady_clock::now();
+                    solver.solve();
+                    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                    if (r > 0) timing.seconds.push_back(seconds);
+                }
+                timings.push_back(timing);
+            }
+        });
+    }
 
-        // Scanner le répertoire pour les fichiers .txt
-        try {
-            for (const auto& entry : std::filesystem::directory_iterator(data_dir)) {
-                if (entry.path().extension() == ".txt") {
-                    instances.push_back(entry.path().string());
+    /**
+     * Base de référence : lignes "# clé,valeur" (runMetadata), puis une ligne par couple
+     * (instance, K) avec la médiane, les quartiles et tous les temps mesurés
+     */
+    bool saveBaseline(const std::string& output_file) const {
+        std::ofstream file(output_file);
+        if (!file.is_open()) {
+            std::cerr << "Erreur: impossible de créer " << output_file << std::endl;
+            return false;
+        }
+
+        for (const auto& entry : runMetadata()) file << "# " << entry.first << "," << entry.second << std::endl;
+        file << "instance_file,instance,N,K,repetitions,median_s,q1_s,q3_s,min_s,max_s,samples_s" << std::endl;
+        for (const auto& timing : timings) {
+            std::vector<double> sorted = timing.seconds;
+            std::sort(sorted.begin(), sorted.end());
+            file << timing.instance_file << ","
+                 << timing.instance_name << ","
+                 << timing.N << ","
+                 << timing.K << ","
+                 << sorted.size() << ","
+                 << std::scientific << std::setprecision(6)
+                 << quantile(sorted, 0.5) << ","
+                 << quantile(sorted, 0.25) << ","
+                 << quantile(sorted, 0.75) << ","
+                 << sorted.front() << ","
+                 << sorted.back() << ",";
+            for (size_t r = 0; r < timing.seconds.size(); r++) file << (r > 0 ? ";" : "") << timing.seconds[r];
+            file << std::endl;
+        }
+
+        file.close();
+        if (!file) {
+            std::cerr << "Erreur: écriture de " << output_file << " incomplète" << std::endl;
+            return false;
+        }
+        std::cout << "✓ Base de référence enregistrée: " << output_file << " (" << timings.size() << " configurations)" << std::endl;
+        return true;
+    }
+
+    // Relit une base de référence écrite par saveBaseline ; les temps sont repris de la colonne samples_s
+    static bool loadBaseline(const std::string& input_file, std::vector<TimingResult>& baseline,
+                             std::map<std::string, std::string>& metadata) {
+        std::ifstream file(input_file);
+        if (!file.is_open()) {
+            std::cerr << "Erreur: base de référence introuvable " << input_file << std::endl;
+            return false;
+        }
+
+        std::string line;
+        bool header = false;
+        while (std::getline(file, line)) {
+            if (line.empty()) continue;
+            if (line[0] == '#') {
+                size_t comma = line.find(',');
+                if (comma != std::string::npos) metadata[line.substr(2, comma - 2)] = line.substr(comma + 1);
+                continue;
+            }
+            if (!header) {
+                header = true;
+                continue;
+            }
+
+            std::vector<std::string> fields;
+            std::stringstream row(line);
+            for (std::string field; std::getline(row, field, ',');) fields.push_back(field);
+            if (fields.size() != 11) {
+                std::cerr << "Erreur: ligne invalide dans " << input_file << ": " << line << std::endl;
+                return false;
+            }
+
+            TimingResult timing;
+            timing.instance_file = fields[0];
+            timing.instance_name = fields[1];
+            try {
+                size_t end_N, end_K;
+                timing.N = std::stoul(fields[2], &end_N);
+                timing.K = std::stoul(fields[3], &end_K);
+                if (end_N != fields[2].size() || end_K != fields[3].size()) throw std::invalid_argument(line);
+                std::stringstream samples(fields[10]);
+                for (std::string sample; std::getline(samples, sample, ';');) {
+                    size_t end;
+                    double seconds = std::stod(sample, &end);
+                    if (end != sample.size() || !(seconds >= 0.0)) throw std::invalid_argument(sample);
+                    timing.seconds.push_back(seconds);
                 }
+            } catch (const std::logic_error&) {
+                std::cerr << "Erreur: valeur invalide dans " << input_file << ": " << line << std::endl;
+                return false;
             }
-            std::sort(instances.begin(), instances.end());
-        } catch (const std::exception& e) {
-            std::cerr << "Erreur lecture répertoire: " << e.what() << std::endl;
-            return 1;
+            baseline.push_back(timing);
         }
+        return true;
     }
 
-    if (argc > 2) {
-        // K values depuis arguments
-        K_values.clear();
-        for (int i = 2; i < argc; i++) {
-            K_values.push_back(std::stoul(argv[i]));
+    /**
+     * Compare les temps mesurés à la base de référence, configuration par configuration.
+     * Une configuration est en régression si sa médiane dépasse celle de la base de plus de
+     * threshold (fraction) et si les intervalles interquartiles sont disjoints (son premier
+     * quartile au-dessus du troisième de la base) : un écart dans le bruit de mesure n'est
+     * pas signalé. Symétriquement pour une accélération. Compte les régressions dans regressions ;
+     * false (sans comparaison) si output_file ne peut pas être créé, ou s'il est incomplet.
+     */
+    bool compareWithBaseline(const std::vector<TimingResult>& baseline, double threshold,
+                             const std::string& output_file, size_t& regressions) const {
+        regressions = 0;
+        std::ofstream file(output_file);
+        if (!file.is_open()) {
+            std::cerr << "Erreur: impossible de créer " << output_file << std::endl;
+            return false;
+        }
+        file << "instance,N,K,baseline_median_s,baseline_q1_s,baseline_q3_s,median_s,q1_s,q3_s,speedup,status" << std::endl;
+
+        std::cout << "\n=== COMPARAISON À LA BASE DE RÉFÉRENCE (seuil " << std::fixed << std::setprecision(1)
+                  << 100.0 * threshold << " %) ===" << std::endl;
+        for (const auto& reference : baseline) {
+            auto current = std::find_if(timings.begin(), timings.end(), [&reference](const TimingResult& timing) {
+                return timing.instance_file == reference.instance_file && timing.K == reference.K;
+            });
+            if (current == timings.end() || current->seconds.empty() || reference.seconds.empty()) {
+                std::cout << reference.instance_name << " K=" << reference.K << ": non mesuré" << std::endl;
+                continue;
+            }
+
+            std::vector<double> before = reference.seconds, after = current->seconds;
+            std::sort(before.begin(), before.end());
+            std::sort(after.begin(), after.end());
+            double median_before = quantile(before, 0.5), median_after = quantile(after, 0.5);
+            double speedup = median_before / median_after;
+
+            std::string status = "stable";
+            if (median_after > (1.0 + threshold) * median_before && quantile(after, 0.25) > quantile(before, 0.75)) {
+                status = "regression";
+                regressions++;
+            } else if (median_before > (1.0 + threshold) * median_after && quantile(before, 0.25) > quantile(after, 0.75)) {
+                status = "faster";
+            }
+
+            file << reference.instance_name << ","
+                 << reference.N << ","
+                 << reference.K << ","
+                 << std::scientific << std::setprecision(6)
+                 << median_before << ","
+                 << quantile(before, 0.25) << ","
+                 << quantile(before, 0.75) << ","
+                 << median_after << ","
+                 << quantile(after, 0.25) << ","
+                 << quantile(after, 0.75) << ","
+                 << std::fixed << std::setprecision(4)
+                 << speedup << ","
+                 << status << std::endl;
+
+            std::cout << reference.instance_name << " K=" << reference.K << ": " << std::scientific << std::setprecision(3)
+                      << median_before << " s [" << quantile(before, 0.25) << ", " << quantile(before, 0.75) << "] -> "
+                      << median_after << " s [" << quantile(after, 0.25) << ", " << quantile(after, 0.75) << "], "
+                      << std::fixed << std::setprecision(3) << "x" << speedup
+                      << (status == "regression" ? " ✗ régression" : status == "faster" ? " ✓ plus rapide" : "")
+                      << std::endl;
+        }
+
+        file.close();
+        if (!file) {
+            std::cerr << "Erreur: écriture de " << output_file << " incomplète" << std::endl;
+            return false;
         }
+        std::cout << "✓ Résultats exportés: " << output_file << std::endl;
+        return true;
     }
+};
 
-    // Lancer les benchmarks
-    BenchmarkSuite suite(instances, K_values);
-    suite.runBenchmarks();
+// Arguments positionnels d'un mode, avec leur valeur par défaut quand ils sont absents ;
+// une valeur mal formée lève std::invalid_argument
+class ModeArguments {
+public:
+    ModeArguments(int argc, char** argv, int first) {
+        for (int i = first; i < argc; i++) values.push_back(argv[i]);
+    }
 
-    // Exporter et analyser
-    suite.exportResults("results/benchmark_cross_validation.csv");
-    suite.printSummaryByN();
+    size_t size() const { return values.size(); }
+    bool has(size_t i) const { return i < values.size(); }
 
-    std::cout << "\n✓ Benchmark terminé. Consultez benchmark_cross_validation.csv" << std::endl;
+    std::string text(size_t i, const std::string& fallback) const { return has(i) ? values[i] : fallback; }
+
+    size_t count(size_t i, size_t fallback) const {
+        if (!has(i)) return fallback;
+        const std::string& value = values[i];
+        size_t end = 0;
+        unsigned long long parsed = 0;
+        if (!value.empty() && std::isdigit(static_cast<unsigned char>(value[0]))) {
+            try {
+                parsed = std::stoull(value, &end);
+            } catch (const std::out_of_range&) {
+                end = 0;
+            }
+        }
+        if (end == 0 || end != value.size()) throw std::invalid_argument("entier positif attendu: " + value);
+        return static_cast<size_t>(parsed);
+    }
+
+    double number(size_t i, double fallback) const {
+        if (!has(i)) return fallback;
+        const std::string& value = values[i];
+        size_t end = 0;
+        double parsed = 0.0;
+        try {
+            parsed = std::stod(value, &end);
+        } catch (const std::logic_error&) {
+            end = 0;
+        }
+        if (end == 0 || end != value.size() || !std::isfinite(parsed)) {
+            throw std::invalid_argument("nombre attendu: " + value);
+        }
+        return parsed;
+    }
+
+    // Instances .txt du répertoire donné en position i (fallback_dir par défaut)
+    std::vector<std::string> instances(size_t i, const std::string& fallback_dir) const {
+        return listInstances(text(i, fallback_dir));
+    }
+
+private:
+    std::vector<std::string> values;
+};
+
+// Mode de la ligne de commande : ./benchmark <flag> <usage>, run rend le code de sortie
+struct BenchmarkMode {
+    std::string flag;
+    std::string usage;
+    std::function<int(const ModeArguments&)> run;
+};
+
+// Mesure, exporte puis résume ; 1 si les résultats n'ont pas pu être écrits
+int runBenchmark(Benchmark& benchmark, const std::string& output_file) {
+    benchmark.run();
+    bool exported = benchmark.exportResults(output_file);
+    benchmark.printSummary();
+    return exported ? 0 : 1;
+}
+
+// Base de référence des temps de solve
+int recordBaseline(const ModeArguments& args) {
+    std::vector<std::string> instances = args.has(0) ? args.instances(0, "") : DEFAULT_INSTANCES;
+    size_t repetitions = args.count(1, 7);
+    if (repetitions == 0) throw std::invalid_argument("au moins une répétition");
+    if (instances.empty()) throw std::invalid_argument("aucune instance dans " + args.text(0, ""));
 
+    BenchmarkSuite suite(instances, DEFAULT_K_VALUES);
+    suite.runTimings(repetitions);
+    return suite.saveBaseline("results/perf_baseline.csv") ? 0 : 1;
+}
+
+// Comparaison à la base de référence (code de sortie 1 si une configuration ralentit au-delà du seuil)
+int compareToBaseline(const ModeArguments& args) {
+    std::string baseline_file = args.text(0, "results/perf_baseline.csv");
+    double threshold = args.number(1, 10.0) / 100.0;
+    if (threshold < 0.0) throw std::invalid_argument("seuil négatif: " + args.text(1, ""));
+
+    std::vector<TimingResult> baseline;
+    std::map<std::string, std::string> recorded;
+    if (!BenchmarkSuite::loadBaseline(baseline_file, baseline, recorded) || baseline.empty()) {
+        std::cerr << "Erreur: base de référence vide ou illisible: " << baseline_file << std::endl;
+        return 1;
+    }
+
+    // Même grille que la base : instances et valeurs de K dans l'ordre d'enregistrement
+    std::vector<std::string> baseline_instances;
+    std::vector<size_t> baseline_K;
+    size_t repetitions = 1;
+    for (const auto& timing : baseline) {
+        if (std::find(baseline_instances.begin(), baseline_instances.end(), timing.instance_file) == baseline_instances.end()) {
+            baseline_instances.push_back(timing.instance_file);
+        }
+        if (std::find(baseline_K.begin(), baseline_K.end(), timing.K) == baseline_K.end()) baseline_K.push_back(timing.K);
+        repetitions = std::max(repetitions, timing.seconds.size());
+    }
+    repetitions = args.count(2, repetitions);
+    if (repetitions == 0) throw std::invalid_argument("au moins une répétition");
+
+    for (const auto& entry : runMetadata()) {
+        if (entry.first == "date") continue;
+        const std::string& before = recorded[entry.first];
+        std::cout << entry.first << ": " << (before.empty() ? "?" : before);
+        if (before != entry.second) {
+            std::cout << " -> " << entry.second;
+            if (entry.first != "commit") std::cout << " ⚠ différent, temps peu comparables";
+        }
+        std::cout << std::endl;
+    }
+
+    BenchmarkSuite suite(baseline_instances, baseline_K);
+    suite.runTimings(repetitions);
+    size_t regressions;
+    if (!suite.compareWithBaseline(baseline, threshold, "results/perf_comparison.csv", regressions)) return 1;
+    if (regressions > 0) {
+        std::cerr << "✗ " << regressions << " configuration(s) ralentie(s) au-delà de " << std::fixed << std::setprecision(1) << 100.0 * threshold << " %" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ Aucune régression au-delà de " << std::fixed << std::setprecision(1) << 100.0 * threshold << " %" << std::endl;
     return 0;
-}
\ No newline at end of file
+}
+
+// Validation croisée k-medoids / p-median : ./benchmark [data_dir] [K...]
+int runCrossValidation(const ModeArguments& args) {
+    std::vector<std::string> instances = args.has(0) ? args.instances(0, "") : DEFAULT_INSTANCES;
+    std::vector<size_t> K_values = DEFAULT_K_VALUES;
+    if (args.size() > 1) {
+        K_values.clear();
+        for (size_t i = 1; i < args.size(); i++) K_values.push_back(args.count(i, 0));
+    }
+
+    BenchmarkSuite suite(instances, K_values);
+    int status = runBenchmark(suite, "results/benchmark_cross_validation.csv");
+
+    std::cout << "\n✓ Benchmark terminé. Consultez benchmark_cross_validation.csv" << std::endl;
+    return status;
+}
+
+int main(int argc, char** argv) {
+    std::cout << "===============================================" << std::endl;
+    std::cout << "  BENCHMARK CROSS-VALIDATION SOLVERS" << std::endl;
+    std::cout << "===============================================" << std::endl;
+
+    const std::vector<BenchmarkMode> modes = {
+        // Remplissage colonne par colonne, par tuiles et en pipeline
+        {"--tiling", "[data_dir] [L]", [](const ModeArguments& args) {
+            FillTilingBenchmark benchmark(args.instances(0, "data/dataAlea2_5000"), args.count(1, 0));
+            return runBenchmark(benchmark, "results/benchmark_fill_tiling.csv");
+        }},
+        // Précision mixte contre double
+        {"--precision", "[data_dir] [L]", [](const ModeArguments& args) {
+            PrecisionBenchmark benchmark(args.instances(0, "data/dataAlea2_1000"), args.count(1, 0));
+            return runBenchmark(benchmark, "results/benchmark_precision.csv");
+        }},
+        // Affectation de nouveaux points
+        {"--assign", "[data_dir] [queries]", [](const ModeArguments& args) {
+            AssignmentBenchmark benchmark(args.instances(0, "data/dataAlea2_1000"), args.count(1, 10000000));
+            return runBenchmark(benchmark, "results/benchmark_assignment.csv");
+        }},
+        // Solveur approché contre DP exacte
+        {"--coreset", "[data_dir] [epsilon]", [](const ModeArguments& args) {
+            CoresetBenchmark benchmark(args.instances(0, "data/dataAlea2_1000"), args.number(1, 0.01));
+            return runBenchmark(benchmark, "results/benchmark_coreset.csv");
+        }},
+        // FasterPAM contre DP par intervalles
+        {"--pam", "[data_dir] [L]", [](const ModeArguments& args) {
+            PamBenchmark benchmark(args.instances(0, "data/dataAlea2_1000"), args.count(1, 0));
+            return runBenchmark(benchmark, "results/benchmark_pam.csv");
+        }},
+        // K-means par intervalles
+        {"--kmeans", "[data_dir] [L] [fenêtre]", [](const ModeArguments& args) {
+            KMeansBenchmark benchmark(args.instances(0, "data/dataAlea2_1000"), args.count(1, 0), args.count(2, 16));
+            return runBenchmark(benchmark, "results/benchmark_kmeans.csv");
+        }},
+        // K-center par intervalles
+        {"--kcenter", "[data_dir] [L]", [](const ModeArguments& args) {
+            KCenterBenchmark benchmark(args.instances(0, "data/dataAlea2_1000"), args.count(1, 0));
+            return runBenchmark(benchmark, "results/benchmark_kcenter.csv");
+        }},
+        // Latence fichier contre API
+        {"--api", "[data_dir] [répétitions]", [](const ModeArguments& args) {
+            ApiLatencyBenchmark benchmark(args.instances(0, "data"), args.count(1, 20));
+            return runBenchmark(benchmark, "results/benchmark_api.csv");
+        }},
+        // Solves asynchrones sur le pool
+        {"--async", "[data_dir]", [](const ModeArguments& args) {
+            AsyncBenchmark benchmark(args.instances(0, "data/dataAlea2_1000"));
+            return runBenchmark(benchmark, "results/benchmark_async.csv");
+        }},
+        // Solve borné dans le temps
+        {"--deadline", "[data_dir] [L]", [](const ModeArguments& args) {
+            DeadlineBenchmark benchmark(args.instances(0, "data/dataAlea2_1000"), args.count(1, 0));
+            return runBenchmark(benchmark, "results/benchmark_deadline.csv");
+        }},
+        // Passage à l'échelle sur fronts synthétiques
+        {"--scaling", "[N max] [forme] [D] [N max DP exacte]", [](const ModeArguments& args) {
+            FrontOptions front;
+            front.seed = 42;
+            if (args.has(1) && !FrontGenerator::parseShape(args.text(1, ""), front.shape)) {
+                throw std::invalid_argument("forme inconnue " + args.text(1, "") + " (convex, concave ou disconnected)");
+            }
+            front.D = args.count(2, 2);
+            ScalingBenchmark benchmark(front, args.count(0, 1000000), args.count(3, 1000));
+            return runBenchmark(benchmark, "results/benchmark_scaling.csv");
+        }},
+        // Vérifications de correction (code de sortie 1 en cas d'échec)
+        {"--verify", "[data_dir] [vérification]", [](const ModeArguments& args) {
+            VerificationSuite suite(args.instances(0, "data"), args.text(1, ""));
+            int status = runBenchmark(suite, "results/verification.csv");
+            return suite.allPassed() ? status : 1;
+        }},
+        {"--record", "[data_dir] [répétitions]", recordBaseline},
+        {"--compare", "[fichier] [seuil %] [répétitions]", compareToBaseline},
+    };
+
+    try {
+        if (argc > 1 && std::string(argv[1]).compare(0, 2, "--") == 0) {
+            for (const BenchmarkMode& mode : modes) {
+                if (mode.flag == argv[1]) return mode.run(ModeArguments(argc, argv, 2));
+            }
+            std::cerr << "Erreur: mode inconnu " << argv[1] << std::endl;
+            std::cerr << "Usage: " << argv[0] << " [data_dir] [K...]" << std::endl;
+            for (const BenchmarkMode& mode : modes) {
+                std::cerr << "       " << argv[0] << " " << mode.flag << " " << mode.usage << std::endl;
+            }
+            return 1;
+        }
+        return runCrossValidation(ModeArguments(argc, argv, 1));
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur: " << e.what() << std::endl;
+        return 1;
+    }
+}